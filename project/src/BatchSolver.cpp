@@ -0,0 +1,96 @@
+#include <stdexcept>
+
+#include "BatchSolver.h"
+
+BatchSolver::BatchSolver(VertexCoverSolver &solver, std::ostream &output, int nThread)
+    : solver(solver), output(output), scheduler(nThread) {
+    this->maxPendingOutputs = 64 * this->scheduler.GetThreadCount();
+    this->nextSequence = 0;
+    this->nextSequenceToWrite = 0;
+    pthread_mutex_init(&this->mutex, nullptr);
+    pthread_cond_init(&this->writtenCondition, nullptr);
+
+    this->solver.SetSolvingOnCallingThread(true);
+}
+
+BatchSolver::~BatchSolver() {
+    this->Finish();
+    pthread_cond_destroy(&this->writtenCondition);
+    pthread_mutex_destroy(&this->mutex);
+}
+
+void BatchSolver::AcceptLine(const std::string &line) {
+    std::function<std::string()> solve;
+    std::string error;
+    try {
+        solve = this->solver.AcceptLineDeferred(line);
+    }
+    catch (std::invalid_argument &e) {
+        error = std::string("Error: ") + e.what() + "\n";
+    }
+    this->submit(solve, error);
+}
+
+bool BatchSolver::AcceptNextLine(InputReader &reader) {
+    std::function<std::string()> solve;
+    std::string error;
+    try {
+        if (!reader.AcceptNextLine(this->solver, solve)) {
+            return false;
+        }
+    }
+    catch (std::invalid_argument &e) {
+        error = std::string("Error: ") + e.what() + "\n";
+    }
+    this->submit(solve, error);
+    return true;
+}
+
+void BatchSolver::submit(const std::function<std::string()> &solve, const std::string &error) {
+    if (!solve && error.empty()) {
+        return;
+    }
+
+    pthread_mutex_lock(&this->mutex);
+    while (this->nextSequence - this->nextSequenceToWrite >= this->maxPendingOutputs) {
+        pthread_cond_wait(&this->writtenCondition, &this->mutex);
+    }
+    long long sequence = this->nextSequence++;
+    pthread_mutex_unlock(&this->mutex);
+
+    if (!solve) {
+        this->complete(sequence, error);
+        return;
+    }
+
+    this->scheduler.Submit([this, sequence, solve]() {
+        std::string result;
+        try {
+            result = solve();
+        }
+        catch (std::invalid_argument &e) {
+            result = std::string("Error: ") + e.what() + "\n";
+        }
+        this->complete(sequence, result);
+    });
+}
+
+void BatchSolver::Finish() {
+    this->scheduler.Wait();
+    pthread_mutex_lock(&this->mutex);
+    this->output.flush();
+    pthread_mutex_unlock(&this->mutex);
+}
+
+void BatchSolver::complete(long long sequence, const std::string &result) {
+    pthread_mutex_lock(&this->mutex);
+    this->readyOutputs[sequence] = result;
+    auto ready = this->readyOutputs.begin();
+    while (ready != this->readyOutputs.end() && ready->first == this->nextSequenceToWrite) {
+        this->output << ready->second;
+        ready = this->readyOutputs.erase(ready);
+        this->nextSequenceToWrite++;
+    }
+    pthread_cond_broadcast(&this->writtenCondition);
+    pthread_mutex_unlock(&this->mutex);
+}
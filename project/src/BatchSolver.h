@@ -0,0 +1,79 @@
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+#include <map>
+#include <ostream>
+#include <pthread.h>
+#include <string>
+
+#include "InputReader.h"
+#include "VertexCoverSolver.h"
+#include "WorkStealingScheduler.h"
+
+/*
+Solve many graphs in parallel, one graph per task of a work-stealing scheduler
+Lines are read ahead of the graphs being solved, and outputs are written in input order through a reorder buffer
+*/
+class BatchSolver {
+public:
+    /*
+    Write outputs to output, with nThread graphs solved at the same time
+    solver parses lines and is configured to solve a graph on the calling thread
+    */
+    BatchSolver(VertexCoverSolver &solver, std::ostream &output, int nThread);
+
+    /*
+    Same as Finish
+    */
+    ~BatchSolver();
+
+    /*
+    Accept a command line input. Its output, or error message if it is invalid, is written after outputs of previous lines
+    Block while too many outputs are pending, so reading ahead takes bounded memory
+    */
+    void AcceptLine(const std::string &line);
+
+    /*
+    Same as AcceptLine, with the next line of reader. Return false if there are no more lines
+    */
+    bool AcceptNextLine(InputReader &reader);
+
+    /*
+    Wait for all graphs and write all pending outputs
+    */
+    void Finish();
+
+private:
+    VertexCoverSolver &solver;
+
+    std::ostream &output;
+
+    WorkStealingScheduler scheduler;
+
+    // Count of outputs waiting in the reorder buffer or being solved, at most this many
+    int maxPendingOutputs;
+
+    // Sequence number of the next line with output, and of the next output to write
+    long long nextSequence;
+    long long nextSequenceToWrite;
+
+    // Outputs ready but not written yet because an earlier one is not ready, guarded by mutex
+    std::map<long long, std::string> readyOutputs;
+
+    pthread_mutex_t mutex;
+
+    // Signaled when an output is written
+    pthread_cond_t writtenCondition;
+
+    /*
+    Queue solve, or error if it is not empty, as the output of the next sequence. Nothing is queued if both are empty
+    */
+    void submit(const std::function<std::string()> &solve, const std::string &error);
+
+    /*
+    Store output of sequence, and write all outputs ready in order
+    */
+    void complete(long long sequence, const std::string &result);
+};
+
+#endif
@@ -0,0 +1,203 @@
+#include <limits>
+#include <stdexcept>
+
+#include "BipartiteSolver.h"
+
+// Distance of a left vertex not reached in the current phase
+const int unreachedDistance = std::numeric_limits<int>::max();
+
+BipartiteSolver::BipartiteSolver(const Graph &graph) : graph(graph) {
+    this->nVertex = graph.GetVertexCount();
+    this->isBipartite = true;
+    this->matchingSize = 0;
+    this->isLeft = std::vector<bool>(this->nVertex + 1, false);
+
+    // color every connected component from its lowest vertex, a self loop gives a vertex the color of its own neighbor
+    auto isColored = std::vector<bool>(this->nVertex + 1, false);
+    auto queue = std::vector<int>();
+    for (int i = 1; i <= this->nVertex && this->isBipartite; i++) {
+        if (isColored[i]) {
+            continue;
+        }
+        isColored[i] = true;
+        this->isLeft[i] = true;
+        queue.clear();
+        queue.push_back(i);
+        for (size_t head = 0; head < queue.size() && this->isBipartite; head++) {
+            int vertex = queue[head];
+            for (const int *neighbor = graph.GetNeighborsBegin(vertex); neighbor != graph.GetNeighborsEnd(vertex); neighbor++) {
+                if (!isColored[*neighbor]) {
+                    isColored[*neighbor] = true;
+                    this->isLeft[*neighbor] = !this->isLeft[vertex];
+                    queue.push_back(*neighbor);
+                } else if (this->isLeft[*neighbor] == this->isLeft[vertex]) {
+                    this->isBipartite = false;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+bool BipartiteSolver::IsBipartite() const {
+    return this->isBipartite;
+}
+
+void BipartiteSolver::SetCancellationToken(const std::shared_ptr<CancellationToken> &token) {
+    this->cancellationToken = token;
+}
+
+int BipartiteSolver::GetMatchingSize() const {
+    return this->matchingSize;
+}
+
+std::vector<int> BipartiteSolver::Solve() {
+    if (!this->isBipartite) {
+        throw std::invalid_argument("graph is not bipartite");
+    }
+
+    this->mates = std::vector<int>(this->nVertex + 1, 0);
+    this->distances = std::vector<int>(this->nVertex + 1, unreachedDistance);
+    this->nextNeighbors = std::vector<const int *>(this->nVertex + 1, nullptr);
+    this->matchingSize = 0;
+
+    // a greedy matching first, so the phases only augment what it misses
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (!this->isLeft[i]) {
+            continue;
+        }
+        for (const int *neighbor = this->graph.GetNeighborsBegin(i); neighbor != this->graph.GetNeighborsEnd(i); neighbor++) {
+            if (this->mates[*neighbor] == 0) {
+                this->mates[i] = *neighbor;
+                this->mates[*neighbor] = i;
+                this->matchingSize++;
+                break;
+            }
+        }
+    }
+
+    // every phase augments along a maximal set of disjoint shortest paths, and there are O(sqrt(n)) phases
+    while (true) {
+        if (this->cancellationToken) {
+            this->cancellationToken->ThrowIfCancelled();
+        }
+
+        int pathLength = this->findAugmentingLayers();
+        if (pathLength < 0) {
+            break;
+        }
+        for (int i = 1; i <= this->nVertex; i++) {
+            this->nextNeighbors[i] = this->graph.GetNeighborsBegin(i);
+        }
+        for (int i = 1; i <= this->nVertex; i++) {
+            if (this->isLeft[i] && this->mates[i] == 0 && this->augmentFrom(i, pathLength)) {
+                this->matchingSize++;
+            }
+        }
+    }
+
+    return this->getKonigCover();
+}
+
+int BipartiteSolver::findAugmentingLayers() {
+    auto queue = std::vector<int>();
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (this->isLeft[i] && this->mates[i] == 0) {
+            this->distances[i] = 0;
+            queue.push_back(i);
+        } else {
+            this->distances[i] = unreachedDistance;
+        }
+    }
+
+    // left vertices are layered by alternating paths, until the first layer reaching a free right vertex
+    int pathLength = -1;
+    for (size_t head = 0; head < queue.size(); head++) {
+        int vertex = queue[head];
+        if (pathLength >= 0 && this->distances[vertex] >= pathLength) {
+            break;
+        }
+        for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+            int mate = this->mates[*neighbor];
+            if (mate == 0) {
+                pathLength = this->distances[vertex] + 1;
+            } else if (this->distances[mate] == unreachedDistance) {
+                this->distances[mate] = this->distances[vertex] + 1;
+                queue.push_back(mate);
+            }
+        }
+    }
+    return pathLength;
+}
+
+bool BipartiteSolver::augmentFrom(int root, int pathLength) {
+    // left vertices on the path, and the right vertex leading from each to the next, without recursion on long paths
+    auto path = std::vector<int>(1, root);
+    auto via = std::vector<int>();
+    while (!path.empty()) {
+        int vertex = path.back();
+        if (this->nextNeighbors[vertex] == this->graph.GetNeighborsEnd(vertex)) {
+            // no augmenting path goes through vertex in this phase
+            this->distances[vertex] = unreachedDistance;
+            path.pop_back();
+            if (!via.empty()) {
+                via.pop_back();
+            }
+            continue;
+        }
+
+        int neighbor = *this->nextNeighbors[vertex]++;
+        int mate = this->mates[neighbor];
+        if (mate == 0) {
+            if (this->distances[vertex] + 1 != pathLength) {
+                continue;
+            }
+            via.push_back(neighbor);
+            for (size_t i = 0; i < path.size(); i++) {
+                this->mates[path[i]] = via[i];
+                this->mates[via[i]] = path[i];
+            }
+            return true;
+        }
+        if (this->distances[mate] == this->distances[vertex] + 1) {
+            via.push_back(neighbor);
+            path.push_back(mate);
+        }
+    }
+    return false;
+}
+
+std::vector<int> BipartiteSolver::getKonigCover() {
+    // vertices reachable from free left vertices, left to right by any edge and right to left by matching edges
+    // every reached right vertex is matched, otherwise the matching had an augmenting path
+    auto isReached = std::vector<bool>(this->nVertex + 1, false);
+    auto queue = std::vector<int>();
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (this->isLeft[i] && this->mates[i] == 0) {
+            isReached[i] = true;
+            queue.push_back(i);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); head++) {
+        int vertex = queue[head];
+        for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+            if (isReached[*neighbor]) {
+                continue;
+            }
+            isReached[*neighbor] = true;
+            int mate = this->mates[*neighbor];
+            if (mate != 0 && !isReached[mate]) {
+                isReached[mate] = true;
+                queue.push_back(mate);
+            }
+        }
+    }
+
+    auto result = std::vector<int>();
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (this->isLeft[i] != isReached[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,77 @@
+#ifndef BIPARTITE_SOLVER_H
+#define BIPARTITE_SOLVER_H
+
+#include <memory>
+#include <vector>
+
+#include "CancellationToken.h"
+#include "Graph.h"
+
+/*
+Exact minimum vertex cover of a bipartite graph in polynomial time
+Sides are found by 2-coloring with breadth first search. A maximum matching is found by Hopcroft-Karp in O(m sqrt(n)),
+and by Konig's theorem the cover is built from it with the same size: left vertices not reachable from a free left vertex
+by alternating paths, and right vertices reachable
+*/
+class BipartiteSolver {
+public:
+    /*
+    Color the sides of graph, see IsBipartite
+    */
+    explicit BipartiteSolver(const Graph &graph);
+
+    /*
+    Return true if the graph is bipartite, i.e. it has neither an odd cycle nor a self loop
+    */
+    bool IsBipartite() const;
+
+    /*
+    Cancel Solve with token, it throws OperationCancelled once the token is cancelled
+    */
+    void SetCancellationToken(const std::shared_ptr<CancellationToken> &token);
+
+    /*
+    Return minimal vertex cover in ascending order
+    Throws std::invalid_argument if the graph is not bipartite
+    */
+    std::vector<int> Solve();
+
+    /*
+    Return size of the maximum matching found by the last Solve, which is the size of the cover
+    */
+    int GetMatchingSize() const;
+
+private:
+    const Graph &graph;
+
+    int nVertex;
+
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    bool isBipartite;
+
+    // Side of each vertex, true for the left side. The first element is ignored
+    std::vector<bool> isLeft;
+
+    // Vertex matched with each vertex, 0 if free. The first element is ignored
+    std::vector<int> mates;
+
+    // Length of the shortest alternating path from a free left vertex to each left vertex in the current phase
+    std::vector<int> distances;
+
+    // Next neighbor to try of each left vertex in the current phase
+    std::vector<const int *> nextNeighbors;
+
+    int matchingSize;
+
+    // Find the layers of shortest augmenting paths, return their length, or -1 if there is none
+    int findAugmentingLayers();
+
+    // Augment along a shortest path from free left vertex root, return true if one is found
+    bool augmentFrom(int root, int pathLength);
+
+    // Build the cover of Konig's theorem from the maximum matching
+    std::vector<int> getKonigCover();
+};
+
+#endif
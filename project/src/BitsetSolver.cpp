@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "BitsetSolver.h"
+
+// Search nodes between two checks of the cancellation token
+const int nodesPerCancellationCheck = 1024;
+
+/*
+Set of vertices as nWord machine words, vertex v of the graph is bit v-1
+*/
+template <int nWord>
+struct VertexBitset {
+    uint64_t words[nWord];
+
+    static VertexBitset Empty() {
+        VertexBitset result;
+        for (int i = 0; i < nWord; i++) {
+            result.words[i] = 0;
+        }
+        return result;
+    }
+
+    void Set(int bit) {
+        this->words[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+
+    void Reset(int bit) {
+        this->words[bit >> 6] &= ~(uint64_t(1) << (bit & 63));
+    }
+
+    bool Test(int bit) const {
+        return (this->words[bit >> 6] >> (bit & 63)) & 1;
+    }
+
+    bool IsEmpty() const {
+        for (int i = 0; i < nWord; i++) {
+            if (this->words[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int Count() const {
+        int count = 0;
+        for (int i = 0; i < nWord; i++) {
+            count += __builtin_popcountll(this->words[i]);
+        }
+        return count;
+    }
+
+    // Remove the lowest bit and return it, the set must not be empty
+    int PopFirst() {
+        for (int i = 0; ; i++) {
+            if (this->words[i] != 0) {
+                int bit = __builtin_ctzll(this->words[i]);
+                this->words[i] &= this->words[i] - 1;
+                return (i << 6) + bit;
+            }
+        }
+    }
+
+    VertexBitset And(const VertexBitset &other) const {
+        VertexBitset result;
+        for (int i = 0; i < nWord; i++) {
+            result.words[i] = this->words[i] & other.words[i];
+        }
+        return result;
+    }
+
+    VertexBitset AndNot(const VertexBitset &other) const {
+        VertexBitset result;
+        for (int i = 0; i < nWord; i++) {
+            result.words[i] = this->words[i] & ~other.words[i];
+        }
+        return result;
+    }
+};
+
+/*
+Maximum independent set search of BitsetSolver with sets of nWord words
+Candidates are the vertices which may still join the independent set, chosen are the ones already in it
+*/
+template <int nWord>
+class BitsetSearch {
+public:
+    typedef VertexBitset<nWord> Bitset;
+
+    BitsetSearch(const Graph &graph, const std::shared_ptr<CancellationToken> &token) {
+        this->nVertex = graph.GetVertexCount();
+        this->cancellationToken = token;
+        this->nNode = 0;
+        this->adjacency = std::vector<Bitset>(this->nVertex, Bitset::Empty());
+        this->loops = Bitset::Empty();
+        for (int i = 1; i <= this->nVertex; i++) {
+            for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+                if (*neighbor == i) {
+                    this->loops.Set(i - 1);
+                } else {
+                    this->adjacency[i - 1].Set(*neighbor - 1);
+                }
+            }
+        }
+    }
+
+    std::vector<int> Solve(const std::vector<int> &knownCover) {
+        // vertices outside the known cover are independent, they are the best set to beat
+        this->best = Bitset::Empty();
+        if (!knownCover.empty()) {
+            auto isInCover = std::vector<bool>(this->nVertex + 1, false);
+            for (auto vertex : knownCover) {
+                isInCover[vertex] = true;
+            }
+            for (int i = 1; i <= this->nVertex; i++) {
+                if (!isInCover[i]) {
+                    this->best.Set(i - 1);
+                }
+            }
+        }
+        this->bestSize = this->best.Count();
+
+        // a vertex with a self loop is in every cover, so never in the independent set
+        auto candidates = Bitset::Empty();
+        for (int i = 0; i < this->nVertex; i++) {
+            if (!this->loops.Test(i)) {
+                candidates.Set(i);
+            }
+        }
+        this->search(candidates, Bitset::Empty(), 0);
+
+        auto result = std::vector<int>();
+        for (int i = 0; i < this->nVertex; i++) {
+            if (!this->best.Test(i)) {
+                result.push_back(i + 1);
+            }
+        }
+        return result;
+    }
+
+    long long GetNodeCount() const {
+        return this->nNode;
+    }
+
+private:
+    int nVertex;
+
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    // Neighbors of vertex v are adjacency[v-1], without the self loop
+    std::vector<Bitset> adjacency;
+
+    // Vertices with a self loop
+    Bitset loops;
+
+    Bitset best;
+    int bestSize;
+
+    long long nNode;
+
+    void search(Bitset candidates, Bitset chosen, int nChosen) {
+        this->nNode++;
+        if (this->cancellationToken && this->nNode % nodesPerCancellationCheck == 0) {
+            this->cancellationToken->ThrowIfCancelled();
+        }
+
+        // a candidate with at most 1 candidate neighbor is in some maximum independent set
+        bool isReduced = true;
+        while (isReduced) {
+            isReduced = false;
+            auto rest = candidates;
+            while (!rest.IsEmpty()) {
+                int vertex = rest.PopFirst();
+                if (!candidates.Test(vertex)) {
+                    continue;
+                }
+                auto neighbors = this->adjacency[vertex].And(candidates);
+                if (neighbors.Count() <= 1) {
+                    chosen.Set(vertex);
+                    nChosen++;
+                    candidates = candidates.AndNot(neighbors);
+                    candidates.Reset(vertex);
+                    isReduced = true;
+                }
+            }
+        }
+
+        if (candidates.IsEmpty()) {
+            if (nChosen > this->bestSize) {
+                this->best = chosen;
+                this->bestSize = nChosen;
+            }
+            return;
+        }
+        if (nChosen + candidates.Count() <= this->bestSize) {
+            return;
+        }
+        if (nChosen + this->getCliqueCoverCount(candidates, this->bestSize - nChosen) <= this->bestSize) {
+            return;
+        }
+
+        int branchVertex = -1;
+        int maxDegree = -1;
+        auto rest = candidates;
+        while (!rest.IsEmpty()) {
+            int vertex = rest.PopFirst();
+            int degree = this->adjacency[vertex].And(candidates).Count();
+            if (degree > maxDegree) {
+                maxDegree = degree;
+                branchVertex = vertex;
+            }
+        }
+
+        // either branchVertex is in the set and none of its neighbors are, or it is not in the set
+        auto withVertex = chosen;
+        withVertex.Set(branchVertex);
+        auto withoutNeighbors = candidates.AndNot(this->adjacency[branchVertex]);
+        withoutNeighbors.Reset(branchVertex);
+        this->search(withoutNeighbors, withVertex, nChosen + 1);
+
+        candidates.Reset(branchVertex);
+        this->search(candidates, chosen, nChosen);
+    }
+
+    /*
+    Return count of cliques greedily covering candidates, an upper bound of the independent set size among them
+    Counting stops once the count exceeds limit, since the node is not pruned anyway
+    */
+    int getCliqueCoverCount(Bitset candidates, int limit) {
+        int count = 0;
+        while (!candidates.IsEmpty() && count <= limit) {
+            int vertex = candidates.PopFirst();
+            auto extendable = this->adjacency[vertex].And(candidates);
+            while (!extendable.IsEmpty()) {
+                int member = extendable.PopFirst();
+                candidates.Reset(member);
+                extendable = extendable.And(this->adjacency[member]);
+            }
+            count++;
+        }
+        return count;
+    }
+};
+
+bool BitsetSolver::CanSolve(const Graph &graph) {
+    return graph.GetVertexCount() <= BitsetSolver::maxVertexCount;
+}
+
+BitsetSolver::BitsetSolver(const Graph &graph) : graph(graph) {
+    if (!BitsetSolver::CanSolve(graph)) {
+        throw std::invalid_argument("vertex count exceeds the maximum allowed value of bitset solver");
+    }
+    this->nNode = 0;
+}
+
+void BitsetSolver::SetCancellationToken(const std::shared_ptr<CancellationToken> &token) {
+    this->cancellationToken = token;
+}
+
+long long BitsetSolver::GetNodeCount() const {
+    return this->nNode;
+}
+
+std::vector<int> BitsetSolver::Solve(const std::vector<int> &knownCover) {
+    int nVertex = this->graph.GetVertexCount();
+    auto result = std::vector<int>();
+    if (nVertex <= 64) {
+        BitsetSearch<1> search(this->graph, this->cancellationToken);
+        result = search.Solve(knownCover);
+        this->nNode = search.GetNodeCount();
+    } else if (nVertex <= 128) {
+        BitsetSearch<2> search(this->graph, this->cancellationToken);
+        result = search.Solve(knownCover);
+        this->nNode = search.GetNodeCount();
+    } else {
+        BitsetSearch<4> search(this->graph, this->cancellationToken);
+        result = search.Solve(knownCover);
+        this->nNode = search.GetNodeCount();
+    }
+    return result;
+}
@@ -0,0 +1,57 @@
+#ifndef BITSET_SOLVER_H
+#define BITSET_SOLVER_H
+
+#include <memory>
+#include <vector>
+
+#include "CancellationToken.h"
+#include "Graph.h"
+
+/*
+Exact minimum vertex cover of a small graph, as the complement of a maximum independent set
+Adjacency is kept as fixed width bitmasks of 64, 128 or 256 bits, chosen by vertex count, so every set operation is a few machine words
+At every node of the search:
+    a vertex with at most 1 candidate neighbor is put into the independent set
+    the node is pruned if the set so far plus a greedy clique cover count of the candidates is no larger than the best set
+    the candidate of most candidate neighbors is either put into the set, or dropped
+*/
+class BitsetSolver {
+public:
+    // Largest vertex count the solver accepts
+    static const int maxVertexCount = 256;
+
+    /*
+    Return true if graph is small enough for the solver
+    */
+    static bool CanSolve(const Graph &graph);
+
+    /*
+    Throws std::invalid_argument if graph has more than maxVertexCount vertices
+    */
+    explicit BitsetSolver(const Graph &graph);
+
+    /*
+    Cancel Solve with token, it throws OperationCancelled once the token is cancelled
+    */
+    void SetCancellationToken(const std::shared_ptr<CancellationToken> &token);
+
+    /*
+    Return minimal vertex cover in ascending order, starting from knownCover as the best cover if it is not empty
+    knownCover is any vertex cover of the graph, e.g. result of Approx methods
+    */
+    std::vector<int> Solve(const std::vector<int> &knownCover);
+
+    /*
+    Return count of search nodes visited by the last Solve
+    */
+    long long GetNodeCount() const;
+
+private:
+    const Graph &graph;
+
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    long long nNode;
+};
+
+#endif
@@ -0,0 +1,227 @@
+#include <algorithm>
+
+#include "BranchAndBoundSolver.h"
+
+// Search nodes between two checks of the cancellation token
+const int nodesPerCancellationCheck = 1024;
+
+BranchAndBoundSolver::BranchAndBoundSolver(const Graph &graph) : graph(graph) {
+    this->nVertex = graph.GetVertexCount();
+    this->nEdgeLeft = 0;
+    this->nNode = 0;
+}
+
+void BranchAndBoundSolver::SetCancellationToken(const std::shared_ptr<CancellationToken> &token) {
+    this->cancellationToken = token;
+}
+
+long long BranchAndBoundSolver::GetNodeCount() const {
+    return this->nNode;
+}
+
+std::vector<int> BranchAndBoundSolver::Solve(const std::vector<int> &knownCover) {
+    this->degree = std::vector<int>(this->nVertex + 1, 0);
+    this->isRemoved = std::vector<bool>(this->nVertex + 1, false);
+    this->isMatched = std::vector<bool>(this->nVertex + 1, false);
+    this->removedVertices.clear();
+    this->coverVertices.clear();
+    this->pending.clear();
+    this->nEdgeLeft = 0;
+    this->nNode = 0;
+
+    int maxDegree = 0;
+    for (int i = 1; i <= this->nVertex; i++) {
+        for (const int *neighbor = this->graph.GetNeighborsBegin(i); neighbor != this->graph.GetNeighborsEnd(i); neighbor++) {
+            if (*neighbor != i) {
+                this->degree[i]++;
+            }
+        }
+        this->nEdgeLeft += this->degree[i];
+        maxDegree = std::max(maxDegree, this->degree[i]);
+        this->pending.push_back(i);
+    }
+    this->nEdgeLeft /= 2;
+    this->degreeCounts = std::vector<int>(maxDegree + 1, 0);
+
+    // all vertices with edges is always a cover, use the known cover instead if it is given
+    this->bestCover = knownCover;
+    std::sort(this->bestCover.begin(), this->bestCover.end());
+    this->bestCover.erase(std::unique(this->bestCover.begin(), this->bestCover.end()), this->bestCover.end());
+    if (this->bestCover.empty()) {
+        for (int i = 1; i <= this->nVertex; i++) {
+            if (this->graph.GetNeighborsBegin(i) != this->graph.GetNeighborsEnd(i)) {
+                this->bestCover.push_back(i);
+            }
+        }
+    }
+
+    // a vertex with a self loop is in every cover
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (std::binary_search(this->graph.GetNeighborsBegin(i), this->graph.GetNeighborsEnd(i), i)) {
+            this->takeVertex(i);
+        }
+    }
+
+    this->search();
+
+    auto result = this->bestCover;
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void BranchAndBoundSolver::removeVertex(int vertex) {
+    this->isRemoved[vertex] = true;
+    this->removedVertices.push_back(vertex);
+    for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+        if (!this->isRemoved[*neighbor]) {
+            this->degree[*neighbor]--;
+            this->nEdgeLeft--;
+            if (this->degree[*neighbor] <= 2) {
+                this->pending.push_back(*neighbor);
+            }
+        }
+    }
+}
+
+void BranchAndBoundSolver::takeVertex(int vertex) {
+    this->coverVertices.push_back(vertex);
+    this->removeVertex(vertex);
+}
+
+void BranchAndBoundSolver::restore(size_t nRemoved, size_t nCover) {
+    while (this->removedVertices.size() > nRemoved) {
+        int vertex = this->removedVertices.back();
+        this->removedVertices.pop_back();
+        this->isRemoved[vertex] = false;
+        for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+            if (!this->isRemoved[*neighbor]) {
+                this->degree[*neighbor]++;
+                this->nEdgeLeft++;
+            }
+        }
+    }
+    this->coverVertices.resize(nCover);
+    this->pending.clear();
+}
+
+void BranchAndBoundSolver::reduce() {
+    while (!this->pending.empty()) {
+        int vertex = this->pending.back();
+        this->pending.pop_back();
+        if (this->isRemoved[vertex] || this->degree[vertex] > 2) {
+            continue;
+        }
+
+        if (this->degree[vertex] == 0) {
+            this->removeVertex(vertex);
+            continue;
+        }
+
+        int neighbors[2];
+        int nNeighbor = 0;
+        for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+            if (*neighbor != vertex && !this->isRemoved[*neighbor]) {
+                neighbors[nNeighbor++] = *neighbor;
+            }
+        }
+
+        if (nNeighbor == 1) {
+            this->takeVertex(neighbors[0]);
+            this->removeVertex(vertex);
+        }
+        else if (std::binary_search(this->graph.GetNeighborsBegin(neighbors[0]), this->graph.GetNeighborsEnd(neighbors[0]), neighbors[1])) {
+            // a triangle needs two of its vertices, and the neighbors cover at least as much as the vertex
+            this->takeVertex(neighbors[0]);
+            this->takeVertex(neighbors[1]);
+            this->removeVertex(vertex);
+        }
+    }
+}
+
+int BranchAndBoundSolver::getLowerBound() {
+    // every vertex covers at most its degree of edges, so the highest degrees bound how few vertices cover all edges
+    std::fill(this->degreeCounts.begin(), this->degreeCounts.end(), 0);
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (!this->isRemoved[i]) {
+            this->degreeCounts[this->degree[i]]++;
+        }
+    }
+    int degreeBound = 0;
+    long long nCovered = 0;
+    for (int d = this->degreeCounts.size() - 1; d > 0 && nCovered < this->nEdgeLeft; d--) {
+        long long nTaken = std::min<long long>(this->degreeCounts[d], (this->nEdgeLeft - nCovered + d - 1) / d);
+        degreeBound += nTaken;
+        nCovered += nTaken * d;
+    }
+
+    // edges of a matching share no vertex, so each needs a different vertex
+    int matchingBound = 0;
+    for (int i = 1; i <= this->nVertex; i++) {
+        this->isMatched[i] = false;
+    }
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (this->isRemoved[i] || this->isMatched[i]) {
+            continue;
+        }
+        for (const int *neighbor = this->graph.GetNeighborsBegin(i); neighbor != this->graph.GetNeighborsEnd(i); neighbor++) {
+            if (*neighbor != i && !this->isRemoved[*neighbor] && !this->isMatched[*neighbor]) {
+                this->isMatched[i] = true;
+                this->isMatched[*neighbor] = true;
+                matchingBound++;
+                break;
+            }
+        }
+    }
+
+    return std::max(degreeBound, matchingBound);
+}
+
+void BranchAndBoundSolver::search() {
+    this->nNode++;
+    if (this->cancellationToken && this->nNode % nodesPerCancellationCheck == 0) {
+        this->cancellationToken->ThrowIfCancelled();
+    }
+
+    size_t nRemoved = this->removedVertices.size();
+    size_t nCover = this->coverVertices.size();
+    this->reduce();
+    size_t nReducedRemoved = this->removedVertices.size();
+    size_t nReducedCover = this->coverVertices.size();
+
+    if (this->nEdgeLeft == 0) {
+        if (this->coverVertices.size() < this->bestCover.size()) {
+            this->bestCover = this->coverVertices;
+        }
+        this->restore(nRemoved, nCover);
+        return;
+    }
+    if (this->coverVertices.size() + this->getLowerBound() >= this->bestCover.size()) {
+        this->restore(nRemoved, nCover);
+        return;
+    }
+
+    int branchVertex = 0;
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (!this->isRemoved[i] && (branchVertex == 0 || this->degree[i] > this->degree[branchVertex])) {
+            branchVertex = i;
+        }
+    }
+
+    // the vertex is in the cover
+    this->takeVertex(branchVertex);
+    this->search();
+    this->restore(nReducedRemoved, nReducedCover);
+
+    // the vertex is not in the cover, so all its neighbors are
+    if (nReducedCover + this->degree[branchVertex] < this->bestCover.size()) {
+        for (const int *neighbor = this->graph.GetNeighborsBegin(branchVertex); neighbor != this->graph.GetNeighborsEnd(branchVertex); neighbor++) {
+            if (!this->isRemoved[*neighbor]) {
+                this->takeVertex(*neighbor);
+            }
+        }
+        this->removeVertex(branchVertex);
+        this->search();
+    }
+
+    this->restore(nRemoved, nCover);
+}
@@ -0,0 +1,89 @@
+#ifndef BRANCH_AND_BOUND_SOLVER_H
+#define BRANCH_AND_BOUND_SOLVER_H
+
+#include <memory>
+#include <vector>
+
+#include "CancellationToken.h"
+#include "Graph.h"
+
+/*
+Exact minimum vertex cover by branch and bound on the graph itself, without encoding it into clauses
+At every node of the search:
+    degree 0 vertices are removed, the neighbor of a degree 1 vertex is taken,
+    and both neighbors of a degree 2 vertex are taken if they are adjacent
+    the node is pruned if the cover so far plus a lower bound is no smaller than the best cover,
+    the lower bound being the larger of a maximal matching and the fewest highest degrees covering all edges left
+    the vertex of highest degree is either taken, or all its neighbors are taken
+Memory is linear in the size of the graph
+*/
+class BranchAndBoundSolver {
+public:
+    explicit BranchAndBoundSolver(const Graph &graph);
+
+    /*
+    Cancel Solve with token, it throws OperationCancelled once the token is cancelled
+    */
+    void SetCancellationToken(const std::shared_ptr<CancellationToken> &token);
+
+    /*
+    Return minimal vertex cover in ascending order, starting from knownCover as the best cover if it is not empty
+    knownCover is any vertex cover of the graph, e.g. result of Approx methods
+    */
+    std::vector<int> Solve(const std::vector<int> &knownCover);
+
+    /*
+    Return count of search nodes visited by the last Solve
+    */
+    long long GetNodeCount() const;
+
+private:
+    const Graph &graph;
+
+    int nVertex;
+
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    // Count of neighbors not removed, a self loop is not counted
+    std::vector<int> degree;
+
+    std::vector<bool> isRemoved;
+
+    // Count of edges between vertices not removed
+    long long nEdgeLeft;
+
+    // Removed vertices in order of removal, restored backwards when backtracking
+    std::vector<int> removedVertices;
+
+    // Vertices taken into the cover on the current search path
+    std::vector<int> coverVertices;
+
+    std::vector<int> bestCover;
+
+    // Vertices whose degree has dropped to at most 2, to check against reduction rules
+    std::vector<int> pending;
+
+    // Scratch arrays of lower bounds
+    std::vector<int> degreeCounts;
+    std::vector<bool> isMatched;
+
+    long long nNode;
+
+    // Remove vertex with its edges
+    void removeVertex(int vertex);
+
+    // Take vertex into the cover and remove it
+    void takeVertex(int vertex);
+
+    // Restore vertices removed after the first nRemoved, and drop cover vertices after the first nCover
+    void restore(size_t nRemoved, size_t nCover);
+
+    // Apply reduction rules on pending vertices until there is none
+    void reduce();
+
+    int getLowerBound();
+
+    void search();
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <cstring>
+
+#include "BufferedWriter.h"
+
+BufferedWriter::BufferedWriter(std::ostream &output, int bufferSize) : output(output), buffer(std::max(1, bufferSize)) {
+    this->size = 0;
+}
+
+BufferedWriter::~BufferedWriter() {
+    this->Flush();
+}
+
+void BufferedWriter::Write(const char *data, size_t size) {
+    if (this->size + size > this->buffer.size()) {
+        this->writeBuffer();
+        if (size >= this->buffer.size()) {
+            this->output.write(data, size);
+            return;
+        }
+    }
+    std::memcpy(this->buffer.data() + this->size, data, size);
+    this->size += size;
+}
+
+void BufferedWriter::Write(const std::string &text) {
+    this->Write(text.data(), text.size());
+}
+
+void BufferedWriter::Flush() {
+    this->writeBuffer();
+    this->output.flush();
+}
+
+void BufferedWriter::writeBuffer() {
+    if (this->size > 0) {
+        this->output.write(this->buffer.data(), this->size);
+        this->size = 0;
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef BUFFERED_WRITER_H
+#define BUFFERED_WRITER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+Write to an output stream in large blocks
+Text is collected until the buffer is full or Flush is called, a text larger than the buffer is written directly
+*/
+class BufferedWriter {
+public:
+    explicit BufferedWriter(std::ostream &output, int bufferSize = 1 << 16);
+
+    /*
+    Same as Flush
+    */
+    ~BufferedWriter();
+
+    void Write(const char *data, size_t size);
+
+    void Write(const std::string &text);
+
+    /*
+    Write everything collected and flush output
+    */
+    void Flush();
+
+private:
+    std::ostream &output;
+
+    // Collected text is buffer[0, size)
+    std::vector<char> buffer;
+    size_t size;
+
+    // Write everything collected, without flushing output
+    void writeBuffer();
+};
+
+#endif
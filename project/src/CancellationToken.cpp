@@ -0,0 +1,57 @@
+#include <algorithm>
+
+#include "CancellationToken.h"
+
+CancellationToken::CancellationToken() {
+    this->isCancelled = false;
+    this->hasDeadline = false;
+    pthread_mutex_init(&this->mutex, nullptr);
+}
+
+CancellationToken::~CancellationToken() {
+    pthread_mutex_destroy(&this->mutex);
+}
+
+void CancellationToken::Cancel() {
+    pthread_mutex_lock(&this->mutex);
+    this->isCancelled = true;
+    for (unsigned i = 0; i < this->solvers.size(); i++) {
+        this->solvers[i]->interrupt();
+    }
+    pthread_mutex_unlock(&this->mutex);
+}
+
+bool CancellationToken::IsCancelled() const {
+    return this->isCancelled || (this->hasDeadline && std::chrono::steady_clock::now() >= this->deadline);
+}
+
+void CancellationToken::ThrowIfCancelled() const {
+    if (this->IsCancelled()) {
+        throw OperationCancelled();
+    }
+}
+
+void CancellationToken::SetDeadline(std::chrono::steady_clock::time_point deadline) {
+    this->hasDeadline = true;
+    this->deadline = deadline;
+}
+
+bool CancellationToken::HasDeadline() const {
+    return this->hasDeadline;
+}
+
+void CancellationToken::AttachSolver(Minisat::Solver *solver) {
+    pthread_mutex_lock(&this->mutex);
+    this->solvers.push_back(solver);
+    // cancelled before the solver existed, so Cancel could not reach it
+    if (this->isCancelled) {
+        solver->interrupt();
+    }
+    pthread_mutex_unlock(&this->mutex);
+}
+
+void CancellationToken::DetachSolver(Minisat::Solver *solver) {
+    pthread_mutex_lock(&this->mutex);
+    this->solvers.erase(std::remove(this->solvers.begin(), this->solvers.end(), solver), this->solvers.end());
+    pthread_mutex_unlock(&this->mutex);
+}
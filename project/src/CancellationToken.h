@@ -0,0 +1,71 @@
+#ifndef CANCELLATION_TOKEN_H
+#define CANCELLATION_TOKEN_H
+
+#include <atomic>
+#include <chrono>
+#include <pthread.h>
+#include <stdexcept>
+#include <vector>
+
+#include "minisat/core/Solver.h"
+
+/*
+Thrown by a solving method when its cancellation token is cancelled before it finishes
+*/
+class OperationCancelled : public std::runtime_error {
+public:
+    OperationCancelled() : std::runtime_error("operation cancelled") {}
+};
+
+/*
+Cooperative cancellation shared by one request and every solver working on it
+Solvers attached to the token are interrupted as soon as it is cancelled, so their search returns promptly
+A token may also carry a deadline, after which it counts as cancelled without anyone calling Cancel
+*/
+class CancellationToken {
+public:
+    CancellationToken();
+    ~CancellationToken();
+
+    /*
+    Mark the token as cancelled and interrupt all attached solvers, may be called from any thread
+    */
+    void Cancel();
+
+    /*
+    Return true if Cancel is called or the deadline has passed
+    */
+    bool IsCancelled() const;
+
+    /*
+    Cancel the token at deadline, set before the token is shared with solving threads
+    Nothing interrupts solvers at the deadline, so a solver checks IsCancelled by itself periodically when HasDeadline
+    */
+    void SetDeadline(std::chrono::steady_clock::time_point deadline);
+    bool HasDeadline() const;
+
+    /*
+    Throw OperationCancelled if the token is cancelled
+    */
+    void ThrowIfCancelled() const;
+
+    /*
+    Interrupt solver when the token is cancelled, or right away if it already is
+    A solver must be detached before it is destroyed
+    */
+    void AttachSolver(Minisat::Solver *solver);
+    void DetachSolver(Minisat::Solver *solver);
+
+private:
+    std::atomic<bool> isCancelled;
+
+    bool hasDeadline;
+    std::chrono::steady_clock::time_point deadline;
+
+    // Solvers to interrupt, guarded by mutex
+    std::vector<Minisat::Solver*> solvers;
+
+    pthread_mutex_t mutex;
+};
+
+#endif
@@ -0,0 +1,448 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "CardinalityEncoder.h"
+
+CardinalityEncoding ParseCardinalityEncoding(const std::string &name) {
+    if (name == "auto") {
+        return CardinalityEncoding::Auto;
+    }
+    if (name == "totalizer") {
+        return CardinalityEncoding::Totalizer;
+    }
+    if (name == "truncated-totalizer") {
+        return CardinalityEncoding::TruncatedTotalizer;
+    }
+    if (name == "sequential-counter") {
+        return CardinalityEncoding::SequentialCounter;
+    }
+    if (name == "cardinality-network") {
+        return CardinalityEncoding::CardinalityNetwork;
+    }
+    if (name == "modulo-totalizer") {
+        return CardinalityEncoding::ModuloTotalizer;
+    }
+    throw std::invalid_argument("unknown cardinality encoding");
+}
+
+CardinalityEncoding CardinalityEncoder::Resolve(CardinalityEncoding encoding, int nInputs, int maxBound) {
+    if (encoding != CardinalityEncoding::Auto) {
+        return encoding;
+    }
+
+    // a register of at most 3 bits per input is the smallest encoding for tiny bounds
+    if (maxBound <= 2) {
+        return CardinalityEncoding::SequentialCounter;
+    }
+
+    // totalizer propagates best, and its n*k growth is still affordable
+    if ((long long)nInputs * (maxBound + 1) <= (1 << 18)) {
+        return CardinalityEncoding::TruncatedTotalizer;
+    }
+
+    // bound close to input count, a network of n*log(n)^2 comparators is much smaller than n*k
+    if (maxBound + 1 >= nInputs / 2) {
+        return CardinalityEncoding::CardinalityNetwork;
+    }
+
+    return CardinalityEncoding::ModuloTotalizer;
+}
+
+std::unique_ptr<CardinalityEncoder> CardinalityEncoder::Create(CardinalityEncoding encoding, int nInputs, int maxBound) {
+    switch (CardinalityEncoder::Resolve(encoding, nInputs, maxBound)) {
+    case CardinalityEncoding::Totalizer:
+        return std::unique_ptr<CardinalityEncoder>(new TotalizerEncoder());
+    case CardinalityEncoding::SequentialCounter:
+        return std::unique_ptr<CardinalityEncoder>(new SequentialCounterEncoder());
+    case CardinalityEncoding::CardinalityNetwork:
+        return std::unique_ptr<CardinalityEncoder>(new CardinalityNetworkEncoder());
+    case CardinalityEncoding::ModuloTotalizer:
+        return std::unique_ptr<CardinalityEncoder>(new ModuloTotalizerEncoder());
+    default:
+        return std::unique_ptr<CardinalityEncoder>(new TruncatedTotalizerEncoder());
+    }
+}
+
+void UnaryCardinalityEncoder::AppendAtMostAssumptions(Minisat::Solver &solver, int bound, Minisat::vec<Minisat::Lit> &assumptions) {
+    // without an output for bound + 1 the count can never exceed bound
+    if (bound < (int)this->outputs.size()) {
+        assumptions.push(~this->outputs[bound]);
+    }
+}
+
+/*
+    Encoding with https://www.cs.toronto.edu/~fbacchus/csc2512/Assignments/Bailleux-Boufkhad2003_Chapter_EfficientCNFEncodingOfBooleanC.pdf
+*/
+void TotalizerEncoder::Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) {
+    int nInputs = inputs.size();
+    if (nInputs == 1) {
+        // a single input is the whole count
+        this->outputs = inputs;
+        return;
+    }
+
+    auto linkingVariables = std::vector<Minisat::Lit>();
+    for (int i = 0; i < nInputs + 2; i++) {
+        linkingVariables.push_back(Minisat::mkLit(solver.newVar()));
+    }
+
+    this->appendSummationClauses(solver, linkingVariables, inputs, 0, nInputs - 1);
+
+    // linkingVariables[i] is true if the count is at least i, the constant ends are dropped
+    this->outputs = std::vector<Minisat::Lit>(linkingVariables.begin() + 1, linkingVariables.end() - 1);
+}
+
+void TotalizerEncoder::appendSummationClauses(Minisat::Solver &solver, const std::vector<Minisat::Lit> &linkingVariables, const std::vector<Minisat::Lit> &inputVariables, int left, int right) {
+    // linkingVariables[0] is forced to be 1, linkingVariables[linkingVariables.size()-1] is forced to be 0, and in between is the actual value of linkingVariables
+    solver.addClause(linkingVariables[0]);
+    solver.addClause(~linkingVariables[linkingVariables.size()-1]);
+
+    if (left == right) {
+        return;
+    }
+
+    // Split to a: [left, middle] and b: [middle+1, right], clauses will be equivilant to (linkingVariables = a + b)
+    // values are in in unary representation (e.g. 5-bit 3 is encoded as 11100), and each bit is a variable in the solver
+    int middle = (left + right) / 2;
+
+    // left part
+    auto leftVariables = std::vector<Minisat::Lit>();
+    leftVariables.push_back(Minisat::mkLit(solver.newVar()));
+    if (left == middle) {
+        // reaches leaf node, use the correcponindg input variable
+        leftVariables.push_back(inputVariables[left]);
+    }
+    else {
+        for (int i = 0; i < middle-left+1; i++) {
+            leftVariables.push_back(Minisat::mkLit(solver.newVar()));
+        }
+    }
+    leftVariables.push_back(Minisat::mkLit(solver.newVar()));
+
+    // right part
+    auto rightVariables = std::vector<Minisat::Lit>();
+    rightVariables.push_back(Minisat::mkLit(solver.newVar()));
+    if (right == middle + 1) {
+        // reaches leaf node, use the correcponindg input variable
+        rightVariables.push_back(inputVariables[right]);
+    } else {
+        for (int i = 0; i < right-middle; i++) {
+            rightVariables.push_back(Minisat::mkLit(solver.newVar()));
+        }
+    }
+    rightVariables.push_back(Minisat::mkLit(solver.newVar()));
+
+    // linkingVariables = leftVariables + rightVariables
+    for (unsigned sum = 0; sum <= linkingVariables.size()-2; sum++) {
+        for (unsigned a = 0; a <= leftVariables.size()-2; a++) {
+            unsigned b = sum - a;
+            if (b >= 0 && b <= rightVariables.size()-2) {
+                solver.addClause(~leftVariables[a], ~rightVariables[b], linkingVariables[sum]);
+                solver.addClause(leftVariables[a+1], rightVariables[b+1], ~linkingVariables[sum+1]);
+            }
+        }
+    }
+
+    // recursion
+    this->appendSummationClauses(solver, leftVariables, inputVariables, left, middle);
+    this->appendSummationClauses(solver, rightVariables, inputVariables, middle+1, right);
+}
+
+void TruncatedTotalizerEncoder::Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) {
+    // only counts up to maxBound + 1 are needed to reject counts larger than maxBound
+    this->outputs = this->appendSummationClauses(solver, inputs, 0, inputs.size() - 1, maxBound + 1);
+}
+
+std::vector<Minisat::Lit> TruncatedTotalizerEncoder::appendSummationClauses(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputVariables, int left, int right, int maxCount) {
+    if (left == right) {
+        // reaches leaf node, the only output is the input variable itself
+        return std::vector<Minisat::Lit>(1, inputVariables[left]);
+    }
+
+    int middle = (left + right) / 2;
+    auto leftOutputs = this->appendSummationClauses(solver, inputVariables, left, middle, maxCount);
+    auto rightOutputs = this->appendSummationClauses(solver, inputVariables, middle+1, right, maxCount);
+
+    // counts above maxCount are never distinguished, so the outputs stop there
+    int nOutputs = std::min((int)(leftOutputs.size() + rightOutputs.size()), maxCount);
+    auto outputs = std::vector<Minisat::Lit>();
+    for (int i = 0; i < nOutputs; i++) {
+        outputs.push_back(Minisat::mkLit(solver.newVar()));
+    }
+
+    // (left >= a) and (right >= b) implies (outputs >= a + b), only this direction is needed for "at most" constraints
+    // a + b beyond nOutputs is implied by a smaller pair reaching nOutputs, since all lower outputs of a child are implied as well
+    for (int a = 0; a <= (int)leftOutputs.size(); a++) {
+        for (int b = 0; b <= (int)rightOutputs.size() && a + b <= nOutputs; b++) {
+            if (a + b == 0) {
+                continue;
+            }
+            auto clause = Minisat::vec<Minisat::Lit>();
+            if (a > 0) {
+                clause.push(~leftOutputs[a-1]);
+            }
+            if (b > 0) {
+                clause.push(~rightOutputs[b-1]);
+            }
+            clause.push(outputs[a+b-1]);
+            solver.addClause(clause);
+        }
+    }
+
+    return outputs;
+}
+
+/*
+    Encoding with https://www.carstensinz.de/papers/CP-2005.pdf (LTseq)
+    registers[j] of input i is implied true if at least j+1 of the first i+1 inputs are true
+*/
+void SequentialCounterEncoder::Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) {
+    int nInputs = inputs.size();
+    int maxCount = maxBound + 1;
+
+    // the register of the first input is the input itself
+    auto registers = std::vector<Minisat::Lit>(1, inputs[0]);
+
+    for (int i = 1; i < nInputs; i++) {
+        int nRegisters = std::min(i + 1, maxCount);
+        auto nextRegisters = std::vector<Minisat::Lit>();
+        for (int j = 0; j < nRegisters; j++) {
+            nextRegisters.push_back(Minisat::mkLit(solver.newVar()));
+        }
+
+        solver.addClause(~inputs[i], nextRegisters[0]);
+        for (int j = 0; j < nRegisters; j++) {
+            // count of previous inputs is carried over
+            if (j < (int)registers.size()) {
+                solver.addClause(~registers[j], nextRegisters[j]);
+            }
+            // count of previous inputs is increased by the current input
+            if (j > 0 && j - 1 < (int)registers.size()) {
+                solver.addClause(~inputs[i], ~registers[j-1], nextRegisters[j]);
+            }
+        }
+
+        registers = nextRegisters;
+    }
+
+    this->outputs = registers;
+}
+
+/*
+    Encoding with https://www.cs.upc.edu/~oliveras/espai/papers/constraints11.pdf
+    Comparators of Batcher odd-even merge sort put the larger value on the lower wire, so sorted wires are in unary representation
+    Only comparators feeding the first maxBound + 1 wires are encoded, and only in the direction needed for "at most" constraints
+*/
+void CardinalityNetworkEncoder::Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) {
+    int nInputs = inputs.size();
+    int maxCount = std::min(maxBound + 1, nInputs);
+
+    int nWires = 1;
+    while (nWires < nInputs) {
+        nWires <<= 1;
+    }
+
+    auto comparators = std::vector<std::pair<int, int>>();
+    for (int p = 1; p < nWires; p <<= 1) {
+        for (int k = p; k >= 1; k >>= 1) {
+            for (int j = k % p; j + k < nWires; j += 2 * k) {
+                for (int i = 0; i < k; i++) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        comparators.push_back(std::pair<int, int>(i + j, i + j + k));
+                    }
+                }
+            }
+        }
+    }
+
+    // walk backwards to find which comparator outputs are read by a later comparator or are one of the first wires
+    auto isWireNeeded = std::vector<bool>(nWires, false);
+    for (int i = 0; i < maxCount; i++) {
+        isWireNeeded[i] = true;
+    }
+    auto isMaxNeeded = std::vector<bool>(comparators.size(), false);
+    auto isMinNeeded = std::vector<bool>(comparators.size(), false);
+    for (int i = comparators.size() - 1; i >= 0; i--) {
+        int upper = comparators[i].first;
+        int lower = comparators[i].second;
+        isMaxNeeded[i] = isWireNeeded[upper];
+        isMinNeeded[i] = isWireNeeded[lower];
+        isWireNeeded[upper] = isWireNeeded[lower] = isMaxNeeded[i] || isMinNeeded[i];
+    }
+
+    // padding wires are constant false
+    auto wires = std::vector<Minisat::Lit>(inputs.begin(), inputs.end());
+    wires.resize(nWires, Minisat::lit_Undef);
+
+    for (unsigned i = 0; i < comparators.size(); i++) {
+        if (!isMaxNeeded[i] && !isMinNeeded[i]) {
+            continue;
+        }
+
+        int upper = comparators[i].first;
+        int lower = comparators[i].second;
+        Minisat::Lit a = wires[upper];
+        Minisat::Lit b = wires[lower];
+
+        if (a == Minisat::lit_Undef || b == Minisat::lit_Undef) {
+            // comparing with false keeps the other value as max and false as min
+            wires[upper] = (a == Minisat::lit_Undef) ? b : a;
+            wires[lower] = Minisat::lit_Undef;
+            continue;
+        }
+
+        if (isMaxNeeded[i]) {
+            // a or b implies max
+            Minisat::Lit max = Minisat::mkLit(solver.newVar());
+            solver.addClause(~a, max);
+            solver.addClause(~b, max);
+            wires[upper] = max;
+        }
+        if (isMinNeeded[i]) {
+            // a and b implies min
+            Minisat::Lit min = Minisat::mkLit(solver.newVar());
+            solver.addClause(~a, ~b, min);
+            wires[lower] = min;
+        }
+    }
+
+    this->outputs = std::vector<Minisat::Lit>();
+    for (int i = 0; i < maxCount && wires[i] != Minisat::lit_Undef; i++) {
+        this->outputs.push_back(wires[i]);
+    }
+}
+
+/*
+    Encoding with https://doi.org/10.1109/ICTAI.2013.13
+    Count of a node is upper * divisor + lower, where lower is the remainder and a carry is raised when remainders of children overflow
+    Clauses only imply the count upwards: the implied prefix of every node is never smaller than the true count
+*/
+void ModuloTotalizerEncoder::Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) {
+    this->divisor = std::max(2, (int)std::ceil(std::sqrt((double)(maxBound + 1))));
+    this->maxQuotient = maxBound / this->divisor + 1;
+    this->boundActivations.clear();
+    this->root = this->appendSummationClauses(solver, inputs, 0, inputs.size() - 1);
+}
+
+ModuloTotalizerEncoder::ModuloCount ModuloTotalizerEncoder::appendSummationClauses(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputVariables, int left, int right) {
+    ModuloCount result;
+    if (left == right) {
+        // reaches leaf node, an input never overflows the remainder since divisor is at least 2
+        result.lower.push_back(inputVariables[left]);
+        return result;
+    }
+
+    int middle = (left + right) / 2;
+    ModuloCount a = this->appendSummationClauses(solver, inputVariables, left, middle);
+    ModuloCount b = this->appendSummationClauses(solver, inputVariables, middle+1, right);
+
+    int nLowerA = a.lower.size();
+    int nLowerB = b.lower.size();
+    int nUpperA = a.upper.size();
+    int nUpperB = b.upper.size();
+    bool hasCarry = nLowerA + nLowerB >= this->divisor;
+
+    Minisat::Lit carry = Minisat::lit_Undef;
+    if (hasCarry) {
+        carry = Minisat::mkLit(solver.newVar());
+    }
+    int nLower = std::min(this->divisor - 1, nLowerA + nLowerB);
+    for (int i = 0; i < nLower; i++) {
+        result.lower.push_back(Minisat::mkLit(solver.newVar()));
+    }
+    int nUpper = std::min(nUpperA + nUpperB + (hasCarry ? 1 : 0), this->maxQuotient);
+    for (int i = 0; i < nUpper; i++) {
+        result.upper.push_back(Minisat::mkLit(solver.newVar()));
+    }
+
+    // remainders: (a >= i) and (b >= j) implies (lower >= i + j) unless carried, or carry and (lower >= i + j - divisor)
+    for (int i = 0; i <= nLowerA; i++) {
+        for (int j = 0; j <= nLowerB; j++) {
+            int sum = i + j;
+            if (sum == 0) {
+                continue;
+            }
+
+            auto clause = Minisat::vec<Minisat::Lit>();
+            if (i > 0) {
+                clause.push(~a.lower[i-1]);
+            }
+            if (j > 0) {
+                clause.push(~b.lower[j-1]);
+            }
+
+            if (sum < this->divisor) {
+                clause.push(result.lower[sum-1]);
+                if (hasCarry) {
+                    clause.push(carry);
+                }
+                solver.addClause(clause);
+            } else {
+                auto carryClause = Minisat::vec<Minisat::Lit>();
+                clause.copyTo(carryClause);
+                carryClause.push(carry);
+                solver.addClause(carryClause);
+                if (sum > this->divisor) {
+                    clause.push(result.lower[sum-this->divisor-1]);
+                    solver.addClause(clause);
+                }
+            }
+        }
+    }
+
+    // quotients: (a >= i) and (b >= j) implies (upper >= i + j), and (upper >= i + j + 1) with carry
+    // sums beyond nUpper are implied by a smaller pair reaching nUpper
+    for (int i = 0; i <= nUpperA; i++) {
+        for (int j = 0; j <= nUpperB; j++) {
+            auto clause = Minisat::vec<Minisat::Lit>();
+            if (i > 0) {
+                clause.push(~a.upper[i-1]);
+            }
+            if (j > 0) {
+                clause.push(~b.upper[j-1]);
+            }
+
+            int sum = i + j;
+            if (sum > 0 && sum <= nUpper) {
+                auto sumClause = Minisat::vec<Minisat::Lit>();
+                clause.copyTo(sumClause);
+                sumClause.push(result.upper[sum-1]);
+                solver.addClause(sumClause);
+            }
+            if (hasCarry && sum + 1 <= nUpper) {
+                clause.push(~carry);
+                clause.push(result.upper[sum]);
+                solver.addClause(clause);
+            }
+        }
+    }
+
+    return result;
+}
+
+void ModuloTotalizerEncoder::AppendAtMostAssumptions(Minisat::Solver &solver, int bound, Minisat::vec<Minisat::Lit> &assumptions) {
+    int quotient = bound / this->divisor;
+    int remainder = bound % this->divisor;
+
+    // count <= bound if upper < quotient + 1, and lower <= remainder when upper reaches quotient
+    if (quotient < (int)this->root.upper.size()) {
+        assumptions.push(~this->root.upper[quotient]);
+    }
+    if (remainder >= (int)this->root.lower.size() || quotient > (int)this->root.upper.size()) {
+        return;
+    }
+    if (quotient == 0) {
+        assumptions.push(~this->root.lower[remainder]);
+        return;
+    }
+
+    // two literals are bounded together, so the clause is guarded by an activation literal created for this bound
+    auto iterator = this->boundActivations.find(bound);
+    if (iterator == this->boundActivations.end()) {
+        Minisat::Lit activation = Minisat::mkLit(solver.newVar());
+        solver.addClause(~activation, ~this->root.upper[quotient-1], ~this->root.lower[remainder]);
+        iterator = this->boundActivations.insert(std::make_pair(bound, activation)).first;
+    }
+    assumptions.push(iterator->second);
+}
@@ -0,0 +1,138 @@
+#ifndef CARDINALITY_ENCODER_H
+#define CARDINALITY_ENCODER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minisat/core/SolverTypes.h"
+#include "minisat/core/Solver.h"
+
+/*
+Encoding of the cardinality constraint on cover size used by CNF SAT method
+*/
+enum class CardinalityEncoding {
+    // Choose from the other encodings by input count and largest bound
+    Auto,
+    // Bailleux-Boufkhad totalizer counting up to the input count at every node, constraining the exact count
+    Totalizer,
+    // Totalizer truncated at the largest bound plus one, constraining only "at most" the bound
+    TruncatedTotalizer,
+    // Sinz sequential counter with registers truncated at the largest bound plus one
+    SequentialCounter,
+    // Batcher odd-even merge sorting network, pruned to the comparators feeding the first outputs
+    CardinalityNetwork,
+    // Ogawa et al. modulo totalizer, counting quotient and remainder of a divisor separately
+    ModuloTotalizer
+};
+
+/*
+Parse encoding name used on command line
+Throws if the name is not one of:
+    auto, totalizer, truncated-totalizer, sequential-counter, cardinality-network, modulo-totalizer
+*/
+CardinalityEncoding ParseCardinalityEncoding(const std::string &name);
+
+/*
+Interface of "at most k" encodings over a set of input literals
+Clauses are appended once, afterwards any bound in [0, maxBound] is imposed with assumptions, so the solver can be reused incrementally
+*/
+class CardinalityEncoder {
+public:
+    virtual ~CardinalityEncoder() {}
+
+    /*
+    Append clauses counting true literals in inputs, so that the count can be bounded by any value in [0, maxBound]
+    */
+    virtual void Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) = 0;
+
+    /*
+    Append assumption literals constraining the count of true inputs to be at most bound
+    bound should be in [0, maxBound] of Encode
+    */
+    virtual void AppendAtMostAssumptions(Minisat::Solver &solver, int bound, Minisat::vec<Minisat::Lit> &assumptions) = 0;
+
+    /*
+    Create the encoder of a specific encoding, Auto is resolved with nInputs and maxBound
+    */
+    static std::unique_ptr<CardinalityEncoder> Create(CardinalityEncoding encoding, int nInputs, int maxBound);
+
+    /*
+    Resolve Auto to a concrete encoding with nInputs and maxBound, other encodings are returned as is
+    */
+    static CardinalityEncoding Resolve(CardinalityEncoding encoding, int nInputs, int maxBound);
+};
+
+/*
+Encoders with unary outputs, output i (0-based) is implied true if at least i+1 inputs are true
+*/
+class UnaryCardinalityEncoder : public CardinalityEncoder {
+public:
+    void AppendAtMostAssumptions(Minisat::Solver &solver, int bound, Minisat::vec<Minisat::Lit> &assumptions) override;
+
+protected:
+    std::vector<Minisat::Lit> outputs;
+};
+
+class TotalizerEncoder : public UnaryCardinalityEncoder {
+public:
+    void Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) override;
+
+private:
+    /*
+    Append summation clauses for inputVariables ranges in [left, right], with its corresponding linkingVariables
+    */
+    void appendSummationClauses(Minisat::Solver &solver, const std::vector<Minisat::Lit> &linkingVariables, const std::vector<Minisat::Lit> &inputVariables, int left, int right);
+};
+
+class TruncatedTotalizerEncoder : public UnaryCardinalityEncoder {
+public:
+    void Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) override;
+
+private:
+    /*
+    Append truncated summation clauses for inputVariables ranges in [left, right], and return its unary outputs
+    Only the first maxCount outputs are created
+    */
+    std::vector<Minisat::Lit> appendSummationClauses(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputVariables, int left, int right, int maxCount);
+};
+
+class SequentialCounterEncoder : public UnaryCardinalityEncoder {
+public:
+    void Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) override;
+};
+
+class CardinalityNetworkEncoder : public UnaryCardinalityEncoder {
+public:
+    void Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) override;
+};
+
+class ModuloTotalizerEncoder : public CardinalityEncoder {
+public:
+    void Encode(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputs, int maxBound) override;
+    void AppendAtMostAssumptions(Minisat::Solver &solver, int bound, Minisat::vec<Minisat::Lit> &assumptions) override;
+
+private:
+    // Count represented as upper * divisor + lower, both in unary
+    struct ModuloCount {
+        std::vector<Minisat::Lit> lower;
+        std::vector<Minisat::Lit> upper;
+    };
+
+    // Divisor of the count, at least 2
+    int divisor;
+
+    // Largest quotient distinguished, larger quotients are reported as this value
+    int maxQuotient;
+
+    // Outputs of the root node
+    ModuloCount root;
+
+    // Activation literal of the clause bounding a specific count, created on first use
+    std::map<int, Minisat::Lit> boundActivations;
+
+    ModuloCount appendSummationClauses(Minisat::Solver &solver, const std::vector<Minisat::Lit> &inputVariables, int left, int right);
+};
+
+#endif
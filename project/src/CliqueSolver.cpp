@@ -0,0 +1,208 @@
+#include <algorithm>
+
+#include "CliqueSolver.h"
+
+// Search nodes between two checks of the cancellation token
+const int nodesPerCancellationCheck = 1024;
+
+// Edge density, edges over vertex pairs, from which a graph is solved as a clique of its complement
+const double minDenseEdgeDensity = 0.1;
+
+bool CliqueSolver::IsDense(const Graph &graph) {
+    long long nVertex = graph.GetVertexCount();
+    if (nVertex < 2) {
+        return false;
+    }
+
+    long long nDegree = 0;
+    for (int i = 1; i <= nVertex; i++) {
+        nDegree += graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i);
+        if (std::binary_search(graph.GetNeighborsBegin(i), graph.GetNeighborsEnd(i), i)) {
+            nDegree--;
+        }
+    }
+    return nDegree >= minDenseEdgeDensity * nVertex * (nVertex - 1);
+}
+
+CliqueSolver::CliqueSolver(const Graph &graph) : graph(graph) {
+    this->nPosition = 0;
+    this->nWord = 0;
+    this->nNode = 0;
+}
+
+void CliqueSolver::SetCancellationToken(const std::shared_ptr<CancellationToken> &token) {
+    this->cancellationToken = token;
+}
+
+long long CliqueSolver::GetNodeCount() const {
+    return this->nNode;
+}
+
+std::vector<int> CliqueSolver::Solve(const std::vector<int> &knownCover) {
+    int nVertex = this->graph.GetVertexCount();
+    this->nNode = 0;
+
+    // a vertex with a self loop is in every cover, so never in the clique of the complement
+    this->orderedVertices.clear();
+    auto degree = std::vector<int>(nVertex + 1, 0);
+    for (int i = 1; i <= nVertex; i++) {
+        if (!std::binary_search(this->graph.GetNeighborsBegin(i), this->graph.GetNeighborsEnd(i), i)) {
+            this->orderedVertices.push_back(i);
+            degree[i] = this->graph.GetNeighborsEnd(i) - this->graph.GetNeighborsBegin(i);
+        }
+    }
+
+    // highest complement degree first, so coloring starts from the vertices most likely in a large clique
+    std::stable_sort(this->orderedVertices.begin(), this->orderedVertices.end(), [&degree](int a, int b) {
+        return degree[a] < degree[b];
+    });
+    this->nPosition = this->orderedVertices.size();
+    this->nWord = (this->nPosition + 63) / 64;
+
+    auto positions = std::vector<int>(nVertex + 1, -1);
+    for (int i = 0; i < this->nPosition; i++) {
+        positions[this->orderedVertices[i]] = i;
+    }
+
+    // start from all other positions, then drop the neighbors in the graph
+    this->complementRows = std::vector<uint64_t>((size_t)this->nPosition * this->nWord, 0);
+    for (int i = 0; i < this->nPosition; i++) {
+        uint64_t *row = &this->complementRows[(size_t)i * this->nWord];
+        for (int j = 0; j < this->nPosition; j++) {
+            row[j >> 6] |= uint64_t(1) << (j & 63);
+        }
+        row[i >> 6] &= ~(uint64_t(1) << (i & 63));
+
+        int vertex = this->orderedVertices[i];
+        for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+            int position = positions[*neighbor];
+            if (position >= 0) {
+                row[position >> 6] &= ~(uint64_t(1) << (position & 63));
+            }
+        }
+    }
+
+    // vertices outside the known cover are independent in the graph, so a clique of the complement to beat
+    this->bestClique.clear();
+    if (!knownCover.empty()) {
+        auto isInCover = std::vector<bool>(nVertex + 1, false);
+        for (auto vertex : knownCover) {
+            isInCover[vertex] = true;
+        }
+        for (int i = 0; i < this->nPosition; i++) {
+            if (!isInCover[this->orderedVertices[i]]) {
+                this->bestClique.push_back(i);
+            }
+        }
+    }
+
+    // the deepest search path has every position in the clique
+    this->candidateStack = std::vector<std::vector<uint64_t>>(this->nPosition + 1);
+    this->branchStack = std::vector<std::vector<int>>(this->nPosition + 1);
+    this->colorStack = std::vector<std::vector<int>>(this->nPosition + 1);
+    this->uncolored = std::vector<uint64_t>(this->nWord, 0);
+    this->colorClass = std::vector<uint64_t>(this->nWord, 0);
+    this->clique.clear();
+
+    if (this->nPosition > 0) {
+        this->candidateStack[0] = std::vector<uint64_t>(this->nWord, 0);
+        for (int i = 0; i < this->nPosition; i++) {
+            this->candidateStack[0][i >> 6] |= uint64_t(1) << (i & 63);
+        }
+        this->expand(0);
+    }
+
+    auto isInClique = std::vector<bool>(nVertex + 1, false);
+    for (auto position : this->bestClique) {
+        isInClique[this->orderedVertices[position]] = true;
+    }
+    auto result = std::vector<int>();
+    for (int i = 1; i <= nVertex; i++) {
+        if (!isInClique[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+void CliqueSolver::colorCandidates(int depth) {
+    std::vector<int> &branches = this->branchStack[depth];
+    std::vector<int> &colors = this->colorStack[depth];
+    branches.clear();
+    colors.clear();
+
+    // positions of a color below minColor cannot make the clique larger than the best, so they are never branched on
+    int minColor = std::max(1, (int)this->bestClique.size() - (int)this->clique.size() + 1);
+
+    std::copy(this->candidateStack[depth].begin(), this->candidateStack[depth].end(), this->uncolored.begin());
+    int firstUncoloredWord = 0;
+    for (int color = 1; ; color++) {
+        while (firstUncoloredWord < this->nWord && this->uncolored[firstUncoloredWord] == 0) {
+            firstUncoloredWord++;
+        }
+        if (firstUncoloredWord == this->nWord) {
+            break;
+        }
+
+        // a color class is independent in the complement, so each new member drops its complement neighbors
+        std::copy(this->uncolored.begin(), this->uncolored.end(), this->colorClass.begin());
+        for (int word = firstUncoloredWord; word < this->nWord; ) {
+            if (this->colorClass[word] == 0) {
+                word++;
+                continue;
+            }
+            int position = (word << 6) + __builtin_ctzll(this->colorClass[word]);
+            this->colorClass[word] &= this->colorClass[word] - 1;
+            this->uncolored[word] &= ~(uint64_t(1) << (position & 63));
+
+            const uint64_t *row = &this->complementRows[(size_t)position * this->nWord];
+            for (int i = word; i < this->nWord; i++) {
+                this->colorClass[i] &= ~row[i];
+            }
+
+            if (color >= minColor) {
+                branches.push_back(position);
+                colors.push_back(color);
+            }
+        }
+    }
+}
+
+void CliqueSolver::expand(int depth) {
+    this->nNode++;
+    if (this->cancellationToken && this->nNode % nodesPerCancellationCheck == 0) {
+        this->cancellationToken->ThrowIfCancelled();
+    }
+
+    this->colorCandidates(depth);
+    std::vector<uint64_t> &candidates = this->candidateStack[depth];
+    std::vector<uint64_t> &nextCandidates = this->candidateStack[depth + 1];
+    nextCandidates.resize(this->nWord);
+    const std::vector<int> &branches = this->branchStack[depth];
+    const std::vector<int> &colors = this->colorStack[depth];
+
+    for (int i = branches.size() - 1; i >= 0; i--) {
+        // colors only decrease from here on, so the rest of the candidates are bounded too
+        if (this->clique.size() + colors[i] <= this->bestClique.size()) {
+            return;
+        }
+
+        int position = branches[i];
+        this->clique.push_back(position);
+
+        const uint64_t *row = &this->complementRows[(size_t)position * this->nWord];
+        bool isEmpty = true;
+        for (int word = 0; word < this->nWord; word++) {
+            nextCandidates[word] = candidates[word] & row[word];
+            isEmpty = isEmpty && nextCandidates[word] == 0;
+        }
+        if (!isEmpty) {
+            this->expand(depth + 1);
+        } else if (this->clique.size() > this->bestClique.size()) {
+            this->bestClique = this->clique;
+        }
+
+        this->clique.pop_back();
+        candidates[position >> 6] &= ~(uint64_t(1) << (position & 63));
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef CLIQUE_SOLVER_H
+#define CLIQUE_SOLVER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "CancellationToken.h"
+#include "Graph.h"
+
+/*
+Exact minimum vertex cover of a dense graph, as all vertices but a maximum clique of the complement graph
+The clique is searched bit-parallel in the style of BBMC: candidate sets and complement adjacency are rows of 64 bit words,
+vertices are ordered by complement degree, and every node is bounded by a greedy coloring of its candidates,
+so only candidates whose color may still improve the best clique are branched on, highest color first
+A dense graph has a sparse complement, where cliques are small and the coloring bound is tight
+*/
+class CliqueSolver {
+public:
+    /*
+    Return true if edge density of graph is high enough for the solver to beat the other exact methods
+    */
+    static bool IsDense(const Graph &graph);
+
+    explicit CliqueSolver(const Graph &graph);
+
+    /*
+    Cancel Solve with token, it throws OperationCancelled once the token is cancelled
+    */
+    void SetCancellationToken(const std::shared_ptr<CancellationToken> &token);
+
+    /*
+    Return minimal vertex cover in ascending order, starting from knownCover as the best cover if it is not empty
+    knownCover is any vertex cover of the graph, e.g. result of Approx methods
+    */
+    std::vector<int> Solve(const std::vector<int> &knownCover);
+
+    /*
+    Return count of search nodes visited by the last Solve
+    */
+    long long GetNodeCount() const;
+
+private:
+    const Graph &graph;
+
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    // Count of vertices without a self loop, the only ones that may be in the clique
+    int nPosition;
+
+    // Count of 64 bit words of a set of positions
+    int nWord;
+
+    // Vertex of the graph at each position of the search order
+    std::vector<int> orderedVertices;
+
+    // Complement neighbors of position p are bits of words [p * nWord, (p+1) * nWord)
+    std::vector<uint64_t> complementRows;
+
+    // Candidate set of each search depth
+    std::vector<std::vector<uint64_t>> candidateStack;
+
+    // Candidates to branch on at each search depth in coloring order, with their colors
+    std::vector<std::vector<int>> branchStack;
+    std::vector<std::vector<int>> colorStack;
+
+    // Scratch sets of coloring
+    std::vector<uint64_t> uncolored;
+    std::vector<uint64_t> colorClass;
+
+    // Positions in the clique on the current search path
+    std::vector<int> clique;
+
+    std::vector<int> bestClique;
+
+    long long nNode;
+
+    // Color candidates of depth greedily, keeping those whose color can still lead to a larger clique than the best
+    void colorCandidates(int depth);
+
+    void expand(int depth);
+};
+
+#endif
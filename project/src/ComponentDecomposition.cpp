@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <numeric>
+
+#include "ComponentDecomposition.h"
+
+// Union-find root of every vertex, with path halving and union by size
+class DisjointSets {
+public:
+    explicit DisjointSets(int size) : parent(size), setSize(size, 1) {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    int Find(int element) {
+        while (parent[element] != element) {
+            parent[element] = parent[parent[element]];
+            element = parent[element];
+        }
+        return element;
+    }
+
+    void Union(int element_1, int element_2) {
+        int root_1 = this->Find(element_1);
+        int root_2 = this->Find(element_2);
+        if (root_1 == root_2) {
+            return;
+        }
+        if (setSize[root_1] < setSize[root_2]) {
+            std::swap(root_1, root_2);
+        }
+        parent[root_2] = root_1;
+        setSize[root_1] += setSize[root_2];
+    }
+
+private:
+    std::vector<int> parent;
+    std::vector<int> setSize;
+};
+
+// Union endpoints of every edge, and return the sets
+DisjointSets joinEdges(const Graph &graph) {
+    int nVertex = graph.GetVertexCount();
+    DisjointSets sets(nVertex + 1);
+    for (int i = 1; i <= nVertex; i++) {
+        for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+            if (*neighbor > i) {
+                sets.Union(i, *neighbor);
+            }
+        }
+    }
+    return sets;
+}
+
+int ComponentDecomposition::CountComponents(const Graph &graph) {
+    int nVertex = graph.GetVertexCount();
+    DisjointSets sets = joinEdges(graph);
+
+    int count = 0;
+    for (int i = 1; i <= nVertex; i++) {
+        if (sets.Find(i) == i && graph.GetNeighborsBegin(i) != graph.GetNeighborsEnd(i)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+ComponentDecomposition::ComponentDecomposition(const Graph &graph) {
+    this->nVertex = graph.GetVertexCount();
+    DisjointSets sets = joinEdges(graph);
+
+    // component index of every root, and local index of every vertex in its component
+    auto componentOfRoot = std::vector<int>(nVertex + 1, -1);
+    auto localIndex = std::vector<int>(nVertex + 1, 0);
+    auto componentEdgeCounts = std::vector<long long>();
+    for (int i = 1; i <= nVertex; i++) {
+        if (graph.GetNeighborsBegin(i) == graph.GetNeighborsEnd(i)) {
+            continue;
+        }
+        int root = sets.Find(i);
+        if (componentOfRoot[root] < 0) {
+            componentOfRoot[root] = this->componentVertices.size();
+            this->componentVertices.push_back(std::vector<int>(1, 0));
+            componentEdgeCounts.push_back(0);
+        }
+        auto &vertices = this->componentVertices[componentOfRoot[root]];
+        localIndex[i] = vertices.size();
+        vertices.push_back(i);
+        componentEdgeCounts[componentOfRoot[root]] += graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i);
+    }
+
+    // largest components first, so they start early when solved in parallel
+    int nComponent = this->componentVertices.size();
+    auto order = std::vector<int>(nComponent);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return componentEdgeCounts[a] > componentEdgeCounts[b];
+    });
+
+    auto sortedVertices = std::vector<std::vector<int>>(nComponent);
+    for (int i = 0; i < nComponent; i++) {
+        sortedVertices[i].swap(this->componentVertices[order[i]]);
+    }
+    this->componentVertices.swap(sortedVertices);
+
+    for (int i = 0; i < nComponent; i++) {
+        const auto &vertices = this->componentVertices[i];
+        auto edges = std::vector<std::pair<int, int>>();
+        for (unsigned j = 1; j < vertices.size(); j++) {
+            for (const int *neighbor = graph.GetNeighborsBegin(vertices[j]); neighbor != graph.GetNeighborsEnd(vertices[j]); neighbor++) {
+                if (*neighbor >= vertices[j]) {
+                    edges.push_back(std::pair<int, int>(j, localIndex[*neighbor]));
+                }
+            }
+        }
+        this->components.push_back(std::unique_ptr<Graph>(new Graph(vertices.size() - 1, edges)));
+    }
+}
+
+int ComponentDecomposition::GetComponentCount() const {
+    return this->components.size();
+}
+
+Graph &ComponentDecomposition::GetComponent(int index) {
+    return *this->components[index];
+}
+
+std::vector<int> ComponentDecomposition::MergeCovers(const std::vector<std::vector<int>> &componentCovers) const {
+    auto isInCover = std::vector<bool>(this->nVertex + 1, false);
+    for (unsigned i = 0; i < componentCovers.size(); i++) {
+        for (unsigned j = 0; j < componentCovers[i].size(); j++) {
+            isInCover[this->componentVertices[i][componentCovers[i][j]]] = true;
+        }
+    }
+
+    auto result = std::vector<int>();
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (isInCover[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,45 @@
+#ifndef COMPONENT_DECOMPOSITION_H
+#define COMPONENT_DECOMPOSITION_H
+
+#include <memory>
+#include <vector>
+
+#include "Graph.h"
+
+/*
+Split a graph into connected components with edges, found by union-find over its edges.
+Vertices without edges belong to no component, since they are never needed in a cover.
+*/
+class ComponentDecomposition {
+public:
+    explicit ComponentDecomposition(const Graph &graph);
+
+    int GetComponentCount() const;
+
+    /*
+    Return component of index in [0, component count), vertices are renumbered to [1, vertex count of component]
+    Components are ordered by edge count in descending order
+    */
+    Graph &GetComponent(int index);
+
+    /*
+    Return a vertex cover of the original graph in ascending order, from a vertex cover of every component in component order
+    */
+    std::vector<int> MergeCovers(const std::vector<std::vector<int>> &componentCovers) const;
+
+    /*
+    Return count of connected components with edges, without building them
+    */
+    static int CountComponents(const Graph &graph);
+
+private:
+    // Vertex count of the original graph
+    int nVertex;
+
+    std::vector<std::unique_ptr<Graph>> components;
+
+    // Original vertex of each component vertex. The first element of each is ignored
+    std::vector<std::vector<int>> componentVertices;
+};
+
+#endif
@@ -0,0 +1,220 @@
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CoverCacheFile.h"
+
+const char coverCacheFileMagic[8] = {'V', 'C', 'C', 'O', 'V', 'E', 'R', '\0'};
+
+struct CoverCacheFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+
+struct CoverRecordHeader {
+    uint64_t hash_1;
+    uint64_t hash_2;
+    int32_t nVertex;
+    int32_t nNeighbors;
+    int32_t coverSize;
+    uint32_t checksum;
+};
+
+// 32-bit FNV-1a over bytes, continuing from hash
+uint32_t hashRecordBytes(uint32_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t getRecordChecksum(CoverRecordHeader header, const void *cover) {
+    header.checksum = 0;
+    uint32_t hash = hashRecordBytes(2166136261u, &header, sizeof(header));
+    return hashRecordBytes(hash, cover, header.coverSize * sizeof(int32_t));
+}
+
+// Write all of data at offset, retrying short writes
+bool writeAllAt(int fd, const char *data, size_t size, off_t offset) {
+    while (size > 0) {
+        ssize_t nWritten = pwrite(fd, data, size, offset);
+        if (nWritten <= 0) {
+            return false;
+        }
+        data += nWritten;
+        size -= nWritten;
+        offset += nWritten;
+    }
+    return true;
+}
+
+CoverCacheFile::CoverCacheFile(const std::string &path) {
+    this->path = path;
+    this->mappedData = nullptr;
+    this->mappedSize = 0;
+    this->scannedEnd = sizeof(CoverCacheFileHeader);
+
+    this->fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (this->fd < 0) {
+        throw std::runtime_error("not able to open cover cache file " + path);
+    }
+
+    // the first process writes the header, under the lock so others never see a file without one
+    flock(this->fd, LOCK_EX);
+    struct stat fileStat;
+    CoverCacheFileHeader header;
+    std::string error;
+    if (fstat(this->fd, &fileStat) != 0) {
+        error = "not able to open cover cache file " + path;
+    }
+    else if (fileStat.st_size == 0) {
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, coverCacheFileMagic, sizeof(header.magic));
+        header.version = COVER_CACHE_FILE_VERSION;
+        if (!writeAllAt(this->fd, (const char*)&header, sizeof(header), 0)) {
+            error = "not able to write cover cache file " + path;
+        }
+    }
+    else if ((size_t)fileStat.st_size < sizeof(header) || pread(this->fd, &header, sizeof(header), 0) != sizeof(header)
+        || std::memcmp(header.magic, coverCacheFileMagic, sizeof(header.magic)) != 0) {
+        error = "not a cover cache file " + path;
+    }
+    else if (header.version != COVER_CACHE_FILE_VERSION) {
+        error = "unsupported cover cache file version " + std::to_string(header.version) + " of " + path;
+    }
+    flock(this->fd, LOCK_UN);
+
+    if (!error.empty()) {
+        close(this->fd);
+        throw std::runtime_error(error);
+    }
+
+    pthread_mutex_init(&this->mutex, nullptr);
+    this->refresh();
+}
+
+CoverCacheFile::~CoverCacheFile() {
+    if (this->mappedData != nullptr) {
+        munmap((void*)this->mappedData, this->mappedSize);
+    }
+    close(this->fd);
+    pthread_mutex_destroy(&this->mutex);
+}
+
+bool CoverCacheFile::Find(const GraphFingerprint &fingerprint, std::vector<int> &cover) {
+    pthread_mutex_lock(&this->mutex);
+    auto record = this->recordOffsets.find(fingerprint);
+    if (record == this->recordOffsets.end()) {
+        // another process may have solved it since
+        this->refresh();
+        record = this->recordOffsets.find(fingerprint);
+    }
+
+    bool isFound = record != this->recordOffsets.end();
+    if (isFound) {
+        CoverRecordHeader header;
+        std::memcpy(&header, this->mappedData + record->second, sizeof(header));
+        const char *coverData = this->mappedData + record->second + sizeof(header);
+        cover.resize(header.coverSize);
+        std::memcpy(cover.data(), coverData, header.coverSize * sizeof(int32_t));
+    }
+    pthread_mutex_unlock(&this->mutex);
+    return isFound;
+}
+
+void CoverCacheFile::Insert(const GraphFingerprint &fingerprint, const std::vector<int> &cover) {
+    CoverRecordHeader header;
+    header.hash_1 = fingerprint.hash_1;
+    header.hash_2 = fingerprint.hash_2;
+    header.nVertex = fingerprint.nVertex;
+    header.nNeighbors = fingerprint.nNeighbors;
+    header.coverSize = cover.size();
+    header.checksum = getRecordChecksum(header, cover.data());
+    auto record = std::vector<char>(sizeof(header) + cover.size() * sizeof(int32_t));
+    std::memcpy(record.data(), &header, sizeof(header));
+    std::memcpy(record.data() + sizeof(header), cover.data(), cover.size() * sizeof(int32_t));
+
+    pthread_mutex_lock(&this->mutex);
+    flock(this->fd, LOCK_EX);
+    this->refreshLocked();
+
+    bool isWritten = true;
+    if (this->recordOffsets.find(fingerprint) == this->recordOffsets.end()) {
+        // anything after the last valid record is torn, and is overwritten
+        struct stat fileStat;
+        if (fstat(this->fd, &fileStat) == 0 && (size_t)fileStat.st_size > this->scannedEnd) {
+            isWritten = ftruncate(this->fd, this->scannedEnd) == 0;
+        }
+        isWritten = isWritten && writeAllAt(this->fd, record.data(), record.size(), this->scannedEnd);
+        this->refreshLocked();
+    }
+
+    flock(this->fd, LOCK_UN);
+    pthread_mutex_unlock(&this->mutex);
+    if (!isWritten) {
+        throw std::runtime_error("not able to write cover cache file " + this->path);
+    }
+}
+
+int CoverCacheFile::GetCount() const {
+    pthread_mutex_lock(&this->mutex);
+    int count = this->recordOffsets.size();
+    pthread_mutex_unlock(&this->mutex);
+    return count;
+}
+
+void CoverCacheFile::refresh() {
+    flock(this->fd, LOCK_SH);
+    this->refreshLocked();
+    flock(this->fd, LOCK_UN);
+}
+
+void CoverCacheFile::refreshLocked() {
+    struct stat fileStat;
+    if (fstat(this->fd, &fileStat) != 0) {
+        return;
+    }
+
+    // a torn record may have been cut off and written over, so the file is scanned again even if its size is the same
+    if ((size_t)fileStat.st_size != this->mappedSize) {
+        void *data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_SHARED, this->fd, 0);
+        if (data == MAP_FAILED) {
+            // records stay readable through the old mapping
+            return;
+        }
+        if (this->mappedData != nullptr) {
+            munmap((void*)this->mappedData, this->mappedSize);
+        }
+        this->mappedData = (const char*)data;
+        this->mappedSize = fileStat.st_size;
+    }
+
+    // stops at the first record not complete or not matching its checksum
+    while (this->scannedEnd + sizeof(CoverRecordHeader) <= this->mappedSize) {
+        CoverRecordHeader header;
+        std::memcpy(&header, this->mappedData + this->scannedEnd, sizeof(header));
+        size_t coverBytes = (size_t)header.coverSize * sizeof(int32_t);
+        if (header.coverSize < 0 || coverBytes > this->mappedSize - this->scannedEnd - sizeof(header)) {
+            break;
+        }
+        if (getRecordChecksum(header, this->mappedData + this->scannedEnd + sizeof(header)) != header.checksum) {
+            break;
+        }
+
+        GraphFingerprint fingerprint;
+        fingerprint.hash_1 = header.hash_1;
+        fingerprint.hash_2 = header.hash_2;
+        fingerprint.nVertex = header.nVertex;
+        fingerprint.nNeighbors = header.nNeighbors;
+        this->recordOffsets[fingerprint] = this->scannedEnd;
+        this->scannedEnd += sizeof(header) + coverBytes;
+    }
+}
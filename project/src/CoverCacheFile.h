@@ -0,0 +1,82 @@
+#ifndef COVER_CACHE_FILE_H
+#define COVER_CACHE_FILE_H
+
+#include <pthread.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ResultCache.h"
+
+/*
+Minimum vertex covers by graph fingerprint in an append-only file, kept across runs and shared by processes
+The file is mapped for reading. Records are appended under an exclusive flock and scanned under a shared one,
+so a process never sees a record another process is still writing. Each record has a checksum, and a record torn
+by a process dying while writing it is cut off by the next process appending
+    char     magic[8]       "VCCOVER\0"
+    uint32   version        COVER_CACHE_FILE_VERSION
+    uint32   reserved
+followed by records of
+    uint64   fingerprint hash 1, fingerprint hash 2
+    int32    vertex count, neighbor count of fingerprint
+    int32    cover size
+    uint32   checksum of the record with this field 0
+    int32    cover[cover size]
+*/
+const unsigned COVER_CACHE_FILE_VERSION = 1;
+
+class CoverCacheFile {
+public:
+    /*
+    Open cache file at path, creating it if it does not exist
+    Throws std::runtime_error if the file cannot be opened or is not a cache file of this version
+    */
+    explicit CoverCacheFile(const std::string &path);
+    ~CoverCacheFile();
+
+    /*
+    Set cover to the cover of fingerprint, including records appended by other processes since the last call
+    Return false if the file has no cover of fingerprint
+    */
+    bool Find(const GraphFingerprint &fingerprint, std::vector<int> &cover);
+
+    /*
+    Append cover of fingerprint, unless the file has one already
+    Throws std::runtime_error if the file cannot be written
+    */
+    void Insert(const GraphFingerprint &fingerprint, const std::vector<int> &cover);
+
+    /*
+    Return count of covers read from the file so far
+    */
+    int GetCount() const;
+
+private:
+    std::string path;
+
+    int fd;
+
+    // Mapping of the file, valid for its first mappedSize bytes
+    const char *mappedData;
+    size_t mappedSize;
+
+    // End of the last valid record scanned
+    size_t scannedEnd;
+
+    // Offset of the record of every fingerprint scanned
+    std::unordered_map<GraphFingerprint, size_t, GraphFingerprintHash> recordOffsets;
+
+    // Guards everything above within the process, flock guards the file across processes
+    mutable pthread_mutex_t mutex;
+
+    /*
+    Map the whole file again if its size has changed, and index records after scannedEnd
+    A flock is held by the caller
+    */
+    void refreshLocked();
+
+    // Same as refreshLocked, holding a shared flock
+    void refresh();
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include <cstdint>
+#include <cstring>
+
+#include "EdgeScanner.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EDGE_SCANNER_X86
+#endif
+
+#ifdef EDGE_SCANNER_X86
+
+// Bits of a 64-byte block, bit i for byte i
+struct BlockMasks {
+    // '<', ',' and '>'
+    uint64_t delimiters;
+    // bytes other than delimiters and digits
+    uint64_t invalid;
+};
+
+typedef BlockMasks (*ClassifyBlock)(const char *block);
+
+__attribute__((target("avx2")))
+BlockMasks classifyBlockAVX2(const char *block) {
+    BlockMasks masks = {0, 0};
+    for (int half = 0; half < 2; half++) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(block + half * 32));
+        __m256i delimiters = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('<')), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(','))),
+            _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('>')));
+        // digit if byte - '0' is at most 9 as unsigned
+        __m256i offsets = _mm256_sub_epi8(bytes, _mm256_set1_epi8('0'));
+        __m256i digits = _mm256_cmpeq_epi8(_mm256_min_epu8(offsets, _mm256_set1_epi8(9)), offsets);
+        __m256i valid = _mm256_or_si256(delimiters, digits);
+
+        masks.delimiters |= (uint64_t)(uint32_t)_mm256_movemask_epi8(delimiters) << (half * 32);
+        masks.invalid |= (uint64_t)(uint32_t)~_mm256_movemask_epi8(valid) << (half * 32);
+    }
+    return masks;
+}
+
+__attribute__((target("sse4.2")))
+BlockMasks classifyBlockSSE42(const char *block) {
+    BlockMasks masks = {0, 0};
+    for (int quarter = 0; quarter < 4; quarter++) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(block + quarter * 16));
+        __m128i delimiters = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('<')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(','))),
+            _mm_cmpeq_epi8(bytes, _mm_set1_epi8('>')));
+        __m128i offsets = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+        __m128i digits = _mm_cmpeq_epi8(_mm_min_epu8(offsets, _mm_set1_epi8(9)), offsets);
+        __m128i valid = _mm_or_si128(delimiters, digits);
+
+        masks.delimiters |= (uint64_t)(_mm_movemask_epi8(delimiters) & 0xFFFF) << (quarter * 16);
+        masks.invalid |= (uint64_t)(~_mm_movemask_epi8(valid) & 0xFFFF) << (quarter * 16);
+    }
+    return masks;
+}
+
+// Shuffle moving n digits at the start of a 16-byte load to bytes [8 - n, 8), with zeros before them
+struct DigitShuffles {
+    int8_t masks[9][16];
+
+    DigitShuffles() {
+        for (int n = 0; n <= 8; n++) {
+            for (int i = 0; i < 16; i++) {
+                masks[n][i] = (i >= 8 - n && i < 8) ? i - (8 - n) : -128;
+            }
+        }
+    }
+};
+
+const DigitShuffles digitShuffles;
+
+/*
+Value of n digits in [1, 8] at digits, 16 bytes from digits must be readable
+Digit pairs, quads and the final 8 digits are combined with multiply-add
+*/
+__attribute__((target("sse4.2")))
+int convertDigitsSSE42(const char *digits, int n) {
+    __m128i bytes = _mm_loadu_si128((const __m128i*)digits);
+    bytes = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+    bytes = _mm_shuffle_epi8(bytes, _mm_loadu_si128((const __m128i*)digitShuffles.masks[n]));
+    // the shuffle zeroes the '0' subtracted from padding bytes as well
+    __m128i pairs = _mm_maddubs_epi16(bytes, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0));
+    __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 0, 0, 0, 0));
+    __m128i packed = _mm_packus_epi32(quads, quads);
+    __m128i value = _mm_madd_epi16(packed, _mm_setr_epi16(10000, 1, 0, 0, 0, 0, 0, 0));
+    return _mm_cvtsi128_si32(value);
+}
+
+/*
+Value of the vertex index in [digits, digits + n), or -1 if it is not a valid index in [1, nVertex]
+All bytes in the range are digits already
+*/
+inline long long readVertexIndex(const char *digits, int n, const char *end, int nVertex) {
+    if (n == 0 || n > 10 || (n > 1 && digits[0] == '0')) {
+        return -1;
+    }
+
+    long long value = 0;
+    if (n <= 8 && end - digits >= 16) {
+        value = convertDigitsSSE42(digits, n);
+    } else {
+        for (int i = 0; i < n; i++) {
+            value = value * 10 + (digits[i] - '0');
+        }
+    }
+
+    if (value < 1 || value > nVertex) {
+        return -1;
+    }
+    return value;
+}
+
+bool scanEdgesWithClassifier(ClassifyBlock classify, const char *begin, const char *end, int nVertex, std::vector<std::pair<int, int>> &result) {
+    // delimiters in order of one edge and the separator after it
+    const char pattern[4] = {'<', ',', '>', ','};
+    int patternIndex = 0;
+    const char *lastDelimiter = begin - 1;
+    long long firstNumber = 0;
+
+    char lastBlock[64];
+    for (const char *block = begin; block < end; block += 64) {
+        BlockMasks masks;
+        uint64_t inRange = ~(uint64_t)0;
+        if (end - block >= 64) {
+            masks = classify(block);
+        } else {
+            // partial block copied out, the bytes after end are ignored
+            std::memset(lastBlock, '0', sizeof(lastBlock));
+            std::memcpy(lastBlock, block, end - block);
+            masks = classify(lastBlock);
+            inRange = ((uint64_t)1 << (end - block)) - 1;
+        }
+        if (masks.invalid & inRange) {
+            return false;
+        }
+
+        uint64_t delimiters = masks.delimiters & inRange;
+        while (delimiters != 0) {
+            const char *delimiter = block + __builtin_ctzll(delimiters);
+            delimiters &= delimiters - 1;
+
+            if (*delimiter != pattern[patternIndex]) {
+                return false;
+            }
+            int nDigit = delimiter - lastDelimiter - 1;
+            if (patternIndex == 0 || patternIndex == 3) {
+                // '<' and the separator follow the previous delimiter directly
+                if (nDigit != 0) {
+                    return false;
+                }
+            } else {
+                long long number = readVertexIndex(lastDelimiter + 1, nDigit, end, nVertex);
+                if (number < 0) {
+                    return false;
+                }
+                if (patternIndex == 1) {
+                    firstNumber = number;
+                } else {
+                    result.push_back(std::pair<int, int>(firstNumber, number));
+                }
+            }
+
+            lastDelimiter = delimiter;
+            patternIndex = (patternIndex + 1) % 4;
+        }
+    }
+
+    // the last delimiter must be '>' at the very end
+    return patternIndex == 3 && lastDelimiter == end - 1;
+}
+
+SimdLevel GetSupportedSimdLevel() {
+    static SimdLevel level = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.2")) {
+            return SimdLevel::SSE42;
+        }
+        return SimdLevel::Scalar;
+    }();
+    return level;
+}
+
+bool ScanEdges(SimdLevel level, const char *begin, const char *end, int nVertex, std::vector<std::pair<int, int>> &result) {
+    if (level == SimdLevel::AVX2) {
+        return scanEdgesWithClassifier(classifyBlockAVX2, begin, end, nVertex, result);
+    }
+    if (level == SimdLevel::SSE42) {
+        return scanEdgesWithClassifier(classifyBlockSSE42, begin, end, nVertex, result);
+    }
+    return false;
+}
+
+#else
+
+SimdLevel GetSupportedSimdLevel() {
+    return SimdLevel::Scalar;
+}
+
+bool ScanEdges(SimdLevel level, const char *begin, const char *end, int nVertex, std::vector<std::pair<int, int>> &result) {
+    return false;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef EDGE_SCANNER_H
+#define EDGE_SCANNER_H
+
+#include <vector>
+
+/*
+Instruction set used to scan edges of E lines
+*/
+enum class SimdLevel {
+    // No vector scanning, edges are only read by the character state machine of Parser
+    Scalar,
+    // 16-byte blocks
+    SSE42,
+    // 32-byte blocks
+    AVX2
+};
+
+/*
+Return the best level supported by the running CPU, detected once
+*/
+SimdLevel GetSupportedSimdLevel();
+
+/*
+Read edges "<[i],[i]>(,<[i],[i]>)*" in range [begin, end) with vector instructions of level, which must be supported
+Delimiters are located with vector comparisons, and vertex indices of up to 8 digits are converted with vector multiply-add
+Only well-formed edges with indices in range [1, nVertex] are accepted. Otherwise false is returned with result in unspecified state,
+and the caller reads the edges again one character at a time to report the exact error
+Returns false right away for SimdLevel::Scalar
+*/
+bool ScanEdges(SimdLevel level, const char *begin, const char *end, int nVertex, std::vector<std::pair<int, int>> &result);
+
+#endif
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "ForestSolver.h"
+
+bool ForestSolver::IsForest(const Graph &graph) {
+    // a forest has one edge less than vertices in every tree
+    int nVertex = graph.GetVertexCount();
+    long long nDegree = 0;
+    for (int i = 1; i <= nVertex; i++) {
+        if (std::binary_search(graph.GetNeighborsBegin(i), graph.GetNeighborsEnd(i), i)) {
+            return false;
+        }
+        nDegree += graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i);
+    }
+
+    int nTree = 0;
+    auto isVisited = std::vector<bool>(nVertex + 1, false);
+    auto stack = std::vector<int>();
+    for (int i = 1; i <= nVertex; i++) {
+        if (isVisited[i]) {
+            continue;
+        }
+        nTree++;
+        isVisited[i] = true;
+        stack.push_back(i);
+        while (!stack.empty()) {
+            int vertex = stack.back();
+            stack.pop_back();
+            for (const int *neighbor = graph.GetNeighborsBegin(vertex); neighbor != graph.GetNeighborsEnd(vertex); neighbor++) {
+                if (!isVisited[*neighbor]) {
+                    isVisited[*neighbor] = true;
+                    stack.push_back(*neighbor);
+                }
+            }
+        }
+    }
+    return nDegree / 2 == nVertex - nTree;
+}
+
+ForestSolver::ForestSolver(const Graph &graph) : graph(graph) {
+}
+
+std::vector<int> ForestSolver::Solve() {
+    if (!ForestSolver::IsForest(this->graph)) {
+        throw std::invalid_argument("graph is not a forest");
+    }
+
+    // vertices in breadth first order of their trees, so every parent comes before its children
+    int nVertex = this->graph.GetVertexCount();
+    auto parents = std::vector<int>(nVertex + 1, 0);
+    auto order = std::vector<int>();
+    auto isVisited = std::vector<bool>(nVertex + 1, false);
+    for (int i = 1; i <= nVertex; i++) {
+        if (isVisited[i]) {
+            continue;
+        }
+        isVisited[i] = true;
+        size_t head = order.size();
+        order.push_back(i);
+        for (; head < order.size(); head++) {
+            int vertex = order[head];
+            for (const int *neighbor = this->graph.GetNeighborsBegin(vertex); neighbor != this->graph.GetNeighborsEnd(vertex); neighbor++) {
+                if (!isVisited[*neighbor]) {
+                    isVisited[*neighbor] = true;
+                    parents[*neighbor] = vertex;
+                    order.push_back(*neighbor);
+                }
+            }
+        }
+    }
+
+    // smallest cover of the subtree of each vertex, with the vertex taken or not taken
+    auto takenSizes = std::vector<int>(nVertex + 1, 1);
+    auto skippedSizes = std::vector<int>(nVertex + 1, 0);
+    for (int i = nVertex - 1; i >= 0; i--) {
+        int vertex = order[i];
+        int parent = parents[vertex];
+        if (parent != 0) {
+            takenSizes[parent] += std::min(takenSizes[vertex], skippedSizes[vertex]);
+            skippedSizes[parent] += takenSizes[vertex];
+        }
+    }
+
+    // a root is taken only if that is smaller, a child of a vertex not taken is always taken
+    auto isInCover = std::vector<bool>(nVertex + 1, false);
+    for (int i = 0; i < nVertex; i++) {
+        int vertex = order[i];
+        int parent = parents[vertex];
+        if (parent != 0 && !isInCover[parent]) {
+            isInCover[vertex] = true;
+        } else {
+            isInCover[vertex] = takenSizes[vertex] < skippedSizes[vertex];
+        }
+    }
+
+    auto result = std::vector<int>();
+    for (int i = 1; i <= nVertex; i++) {
+        if (isInCover[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
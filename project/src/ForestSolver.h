@@ -0,0 +1,32 @@
+#ifndef FOREST_SOLVER_H
+#define FOREST_SOLVER_H
+
+#include <vector>
+
+#include "Graph.h"
+
+/*
+Exact minimum vertex cover of a forest in linear time
+Every tree is rooted at its lowest vertex and solved from the leaves up, with the smallest cover of each subtree
+with and without its root, then the covers are chosen from the roots down
+*/
+class ForestSolver {
+public:
+    /*
+    Return true if graph is a forest, i.e. it has neither a cycle nor a self loop
+    */
+    static bool IsForest(const Graph &graph);
+
+    explicit ForestSolver(const Graph &graph);
+
+    /*
+    Return minimal vertex cover in ascending order
+    Throws std::invalid_argument if the graph is not a forest
+    */
+    std::vector<int> Solve();
+
+private:
+    const Graph &graph;
+};
+
+#endif
@@ -1,166 +1,410 @@
 #include <memory>
 #include <stdexcept>
 
+#include "BipartiteSolver.h"
+#include "BitsetSolver.h"
+#include "BranchAndBoundSolver.h"
+#include "CliqueSolver.h"
+#include "ForestSolver.h"
+#include "ComponentDecomposition.h"
 #include "Graph.h"
+#include "Kernelizer.h"
+#include "ThreadPool.h"
+#include "TreeDecompositionSolver.h"
 #include "minisat/core/SolverTypes.h"
 #include "minisat/core/Solver.h"
 
-std::vector<std::set<int>> copyAdjVertices(std::vector<std::set<int>> source) {
-    auto size = source.size();
-    auto newAdjVertices = std::vector<std::set<int>>(size);
-    for (unsigned i = 0; i < size; i++) {
-        newAdjVertices[i] = std::set<int>(source[i]);
-    }
-    return newAdjVertices;
-}
-
-Graph::Graph(int nVertex, std::vector<std::pair<int, int>> edges) {
+Graph::Graph(int nVertex, const std::vector<std::pair<int, int>> &edges) {
     this->nVertex = nVertex;
     this->hasEdges = false;
-    this->adjVertices = std::vector<std::set<int>>(nVertex + 1);
+    this->cardinalityEncoding = CardinalityEncoding::Auto;
+    this->isFastPathEnabled = false;
+    this->maxTreewidth = TreeDecompositionSolver::defaultMaxWidth;
+    auto adjOffsets = std::vector<int>(nVertex + 2, 0);
 
     auto nEdges = edges.size();
     if (nEdges > 0) {
         this->hasEdges = true;
     }
 
+    // count neighbors of each vertex, a self loop is only counted once
+    for (unsigned i = 0; i < nEdges; i++) {
+        adjOffsets[edges[i].first + 1]++;
+        if (edges[i].first != edges[i].second) {
+            adjOffsets[edges[i].second + 1]++;
+        }
+    }
+    for (int i = 1; i <= nVertex + 1; i++) {
+        adjOffsets[i] += adjOffsets[i-1];
+    }
+
+    // scatter both directions of every edge into the row of its vertex
+    auto adjNeighbors = std::vector<int>(adjOffsets[nVertex + 1]);
+    auto cursor = std::vector<int>(adjOffsets.begin(), adjOffsets.end() - 1);
     for (unsigned i = 0; i < nEdges; i++) {
         int vertex_1 = edges[i].first;
         int vertex_2 = edges[i].second;
 
-        // duplicate edges are automatically ignored
-        this->adjVertices[vertex_1].insert(vertex_2);
-        this->adjVertices[vertex_2].insert(vertex_1);
+        adjNeighbors[cursor[vertex_1]++] = vertex_2;
+        if (vertex_1 != vertex_2) {
+            adjNeighbors[cursor[vertex_2]++] = vertex_1;
+        }
+    }
+
+    // sort every row and compact the array in place to drop duplicate edges
+    int writeIndex = 0;
+    for (int i = 1; i <= nVertex; i++) {
+        auto rowBegin = adjNeighbors.begin() + adjOffsets[i];
+        auto rowEnd = adjNeighbors.begin() + adjOffsets[i+1];
+        std::sort(rowBegin, rowEnd);
+        rowEnd = std::unique(rowBegin, rowEnd);
+
+        adjOffsets[i] = writeIndex;
+        for (auto iterator = rowBegin; iterator != rowEnd; iterator++) {
+            adjNeighbors[writeIndex++] = *iterator;
+        }
+    }
+    adjOffsets[nVertex + 1] = writeIndex;
+    adjNeighbors.resize(writeIndex);
+    adjNeighbors.shrink_to_fit();
+
+    this->adjOffsetsStorage.swap(adjOffsets);
+    this->adjNeighborsStorage.swap(adjNeighbors);
+    this->adjOffsets = this->adjOffsetsStorage.data();
+    this->adjNeighbors = this->adjNeighborsStorage.data();
+}
+
+Graph::Graph(int nVertex, const int *adjOffsets, const int *adjNeighbors, const std::shared_ptr<const void> &storage) {
+    this->nVertex = nVertex;
+    this->cardinalityEncoding = CardinalityEncoding::Auto;
+    this->isFastPathEnabled = false;
+    this->maxTreewidth = TreeDecompositionSolver::defaultMaxWidth;
+    this->adjOffsets = adjOffsets;
+    this->adjNeighbors = adjNeighbors;
+    this->externalStorage = storage;
+
+    if (nVertex < 0 || adjOffsets[0] != 0 || adjOffsets[1] != 0) {
+        throw std::invalid_argument("invalid adjacency offsets");
+    }
+    // all offsets are checked before any neighbor is read, so a corrupt offset never reads past the last one
+    for (int i = 1; i <= nVertex; i++) {
+        if (adjOffsets[i+1] < adjOffsets[i]) {
+            throw std::invalid_argument("invalid adjacency offsets");
+        }
+    }
+    for (int i = 1; i <= nVertex; i++) {
+        for (int j = adjOffsets[i]; j < adjOffsets[i+1]; j++) {
+            int neighbor = adjNeighbors[j];
+            if (neighbor < 1 || neighbor > nVertex || (j > adjOffsets[i] && neighbor <= adjNeighbors[j-1])) {
+                throw std::invalid_argument("adjacency list is not sorted or has invalid vertex");
+            }
+        }
+    }
+
+    // every edge must appear in the lists of both vertices. Visiting vertices in ascending order visits the
+    // list of each neighbor in ascending order as well, so one cursor per vertex is enough to match them
+    auto cursor = std::vector<int>(adjOffsets, adjOffsets + nVertex + 1);
+    for (int i = 1; i <= nVertex; i++) {
+        for (int j = adjOffsets[i]; j < adjOffsets[i+1]; j++) {
+            int neighbor = adjNeighbors[j];
+            if (cursor[neighbor] == adjOffsets[neighbor+1] || adjNeighbors[cursor[neighbor]] != i) {
+                throw std::invalid_argument("adjacency list is not symmetric");
+            }
+            cursor[neighbor]++;
+        }
+    }
+
+    this->hasEdges = adjOffsets[nVertex + 1] > 0;
+}
+
+void Graph::SetFastPaths(bool isFastPathEnabled) {
+    this->isFastPathEnabled = isFastPathEnabled;
+}
+
+void Graph::SetMaxTreewidth(int maxTreewidth) {
+    this->maxTreewidth = maxTreewidth;
+}
+
+void Graph::SetCardinalityEncoding(CardinalityEncoding encoding) {
+    this->cardinalityEncoding = encoding;
+}
+
+void Graph::SetCancellationToken(const std::shared_ptr<CancellationToken> &token) {
+    this->cancellationToken = token;
+}
+
+int Graph::GetVertexCount() const {
+    return this->nVertex;
+}
+
+const int *Graph::GetNeighborsBegin(int vertex) const {
+    return this->adjNeighbors + this->adjOffsets[vertex];
+}
+
+const int *Graph::GetNeighborsEnd(int vertex) const {
+    return this->adjNeighbors + this->adjOffsets[vertex + 1];
+}
+
+bool Graph::IsVertexCover(const std::vector<int> &cover) const {
+    auto isInCover = std::vector<bool>(this->nVertex + 1, false);
+    for (unsigned i = 0; i < cover.size(); i++) {
+        if (cover[i] < 1 || cover[i] > this->nVertex) {
+            return false;
+        }
+        isInCover[cover[i]] = true;
+    }
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (isInCover[i]) {
+            continue;
+        }
+        for (int j = this->adjOffsets[i]; j < this->adjOffsets[i+1]; j++) {
+            if (!isInCover[this->adjNeighbors[j]]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool Graph::IsMinimalVertexCoverCandidate(const std::vector<int> &cover, const std::vector<int> &knownCover) {
+    if (!knownCover.empty() && cover.size() > knownCover.size()) {
+        return false;
+    }
+    for (unsigned i = 1; i < cover.size(); i++) {
+        if (cover[i-1] >= cover[i]) {
+            return false;
+        }
+    }
+    if ((int)cover.size() > 2 * this->getVertexCoverLowerBound()) {
+        return false;
     }
+    return this->IsVertexCover(cover);
 }
 
 std::vector<int> Graph::GetMinimalVertexCover_CNF_SAT() {
+    return this->GetMinimalVertexCover_CNF_SAT(std::vector<int>());
+}
+
+std::vector<int> Graph::GetMinimalVertexCover_CNF_SAT(const std::vector<int> &knownCover) {
+    return this->solveKernelComponents(knownCover, [this](Graph &component, const std::vector<int> &componentKnownCover) {
+        component.SetCardinalityEncoding(this->cardinalityEncoding);
+        component.SetCancellationToken(this->cancellationToken);
+        return component.solveMinimalVertexCover_CNF_SAT(componentKnownCover);
+    });
+}
+
+std::vector<int> Graph::GetMinimalVertexCover_BranchAndBound(const std::vector<int> &knownCover) {
+    return this->solveKernelComponents(knownCover, [this](Graph &component, const std::vector<int> &componentKnownCover) {
+        BranchAndBoundSolver solver(component);
+        solver.SetCancellationToken(this->cancellationToken);
+        return solver.Solve(componentKnownCover);
+    });
+}
+
+std::vector<int> Graph::solveKernelComponents(const std::vector<int> &knownCover,
+    const std::function<std::vector<int>(Graph &, const std::vector<int> &)> &solveComponent) {
     if (!this->hasEdges) {
         return std::vector<int>();
     }
 
-    auto result = std::vector<int>();
+    // a forest is solved in linear time, faster than it is reduced
+    if (this->isFastPathEnabled && ForestSolver::IsForest(*this)) {
+        ForestSolver solver(*this);
+        return solver.Solve();
+    }
 
-    // Check vertex cover with size in [1, nVertex-1] with binary search
-    int minSizeLeft = 1;
-    int minSizeRight = nVertex-1;
-    while (minSizeLeft <= minSizeRight) {
-        int minSizeMiddle = (minSizeLeft + minSizeRight) / 2;
-        bool hasCover = this->getVertexCoverOfSize_CNF_SAT(minSizeMiddle, result);
-        if (hasCover) {
-            minSizeRight = result.size() - 1;
-        } else {
-            minSizeLeft = minSizeMiddle + 1;
+    auto distinctCover = std::set<int>(knownCover.begin(), knownCover.end());
+    int upperBound = distinctCover.empty() ? nVertex : distinctCover.size();
+
+    Kernelizer kernelizer(*this, upperBound);
+    ComponentDecomposition decomposition(kernelizer.GetKernel());
+
+    // the known cover does not carry over to the kernel, so each component gets its own approximation
+    auto componentCovers = std::vector<std::vector<int>>(decomposition.GetComponentCount());
+    ThreadPool::Shared().ParallelFor(decomposition.GetComponentCount(), [&](int index) {
+        if (this->cancellationToken) {
+            this->cancellationToken->ThrowIfCancelled();
         }
-    }
 
-    // No need to solve if vertex cover size is same as nVertex, assign the result directly with all vertices
-    // This can happen for graphs containing only self loops
-    if (result.size() == 0) {
-        for (int i = 0; i < nVertex; i++) {
-            result.push_back(i+1);
+        Graph &component = decomposition.GetComponent(index);
+        auto componentKnownCover = std::vector<int>();
+        component.solveWithAPPROX_VC_1(componentKnownCover);
+        if (!this->isFastPathEnabled || !this->solveComponentWithFastPath(component, componentKnownCover, componentCovers[index])) {
+            componentCovers[index] = solveComponent(component, componentKnownCover);
         }
-    }
+    });
 
-    return result;
+    return kernelizer.LiftCover(decomposition.MergeCovers(componentCovers));
 }
 
-void Graph::appendSummationClauses_CNF_SAT(const std::unique_ptr<Minisat::Solver> &solver, const std::vector<Minisat::Lit> &linkingVariables, const std::vector<Minisat::Lit> &inputVariables, int left, int right) {
-    // linkingVariables[0] is forced to be 1, linkingVariables[linkingVariables.size()-1] is forced to be 0, and in between is the actual value of linkingVariables
-    solver->addClause(linkingVariables[0]);
-    solver->addClause(~linkingVariables[linkingVariables.size()-1]);
+bool Graph::solveComponentWithFastPath(Graph &component, const std::vector<int> &knownCover, std::vector<int> &cover) {
+    // bipartite first, since it is solved in polynomial time whatever its size and density
+    BipartiteSolver bipartiteSolver(component);
+    if (bipartiteSolver.IsBipartite()) {
+        bipartiteSolver.SetCancellationToken(this->cancellationToken);
+        cover = bipartiteSolver.Solve();
+        return true;
+    }
 
-    if (left == right) {
-        return;
+    // small treewidth next, since it is solved in time linear in the size
+    TreeDecompositionSolver decompositionSolver(component, this->maxTreewidth);
+    if (decompositionSolver.IsDecomposed()) {
+        decompositionSolver.SetCancellationToken(this->cancellationToken);
+        cover = decompositionSolver.Solve();
+        return true;
     }
 
-    // Split to a: [left, middle] and b: [middle+1, right], clauses will be equivilant to (linkingVariables = a + b)
-    // values are in in unary representation (e.g. 5-bit 3 is encoded as 11100), and each bit is a variable in the solver
-    int middle = (left + right) / 2;
+    // dense then, since a small dense component has a small sparse complement the clique search handles best
+    if (CliqueSolver::IsDense(component)) {
+        CliqueSolver solver(component);
+        solver.SetCancellationToken(this->cancellationToken);
+        cover = solver.Solve(knownCover);
+        return true;
+    }
+    if (BitsetSolver::CanSolve(component)) {
+        BitsetSolver solver(component);
+        solver.SetCancellationToken(this->cancellationToken);
+        cover = solver.Solve(knownCover);
+        return true;
+    }
+    return false;
+}
 
-    // left part
-    auto leftVariables = std::vector<Minisat::Lit>();
-    leftVariables.push_back(Minisat::mkLit(solver->newVar()));
-    if (left == middle) {
-        // reaches leaf node, use the correcponindg input variable
-        leftVariables.push_back(inputVariables[left]);
+std::vector<int> Graph::solveMinimalVertexCover_CNF_SAT(const std::vector<int> &knownCover) {
+    if (!this->hasEdges) {
+        return std::vector<int>();
     }
-    else {
-        for (int i = 0; i < middle-left+1; i++) {
-            leftVariables.push_back(Minisat::mkLit(solver->newVar()));
+
+    // All vertices is always a cover, use the known cover instead if it is given
+    auto result = std::vector<int>(knownCover);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    if (result.empty()) {
+        for (int i = 0; i < nVertex; i++) {
+            result.push_back(i+1);
         }
     }
-    leftVariables.push_back(Minisat::mkLit(solver->newVar()));
 
-    // right part
-    auto rightVariables = std::vector<Minisat::Lit>();
-    rightVariables.push_back(Minisat::mkLit(solver->newVar()));
-    if (right == middle + 1) {
-        // reaches leaf node, use the correcponindg input variable
-        rightVariables.push_back(inputVariables[right]);
+    // Check vertex cover with size in [lower bound, size of best cover - 1]
+    int minSizeLeft = this->getVertexCoverLowerBound();
+    int minSizeRight = result.size() - 1;
+    if (minSizeLeft > minSizeRight) {
+        return result;
+    }
+
+    this->prepareSolver_CNF_SAT(minSizeRight);
+    if (minSizeRight - minSizeLeft < 4) {
+        // Close to the lower bound, search downward so there is only one probe without cover
+        while (minSizeLeft <= minSizeRight && this->getVertexCoverOfSize_CNF_SAT(minSizeRight, result)) {
+            // the cover found may be smaller than the size probed
+            minSizeRight = result.size() - 1;
+        }
     } else {
-        for (int i = 0; i < right-middle; i++) {
-            rightVariables.push_back(Minisat::mkLit(solver->newVar()));
+        // binary search
+        while (minSizeLeft <= minSizeRight) {
+            int minSizeMiddle = (minSizeLeft + minSizeRight) / 2;
+            bool hasCover = this->getVertexCoverOfSize_CNF_SAT(minSizeMiddle, result);
+            if (hasCover) {
+                // the cover found may be smaller than the size probed
+                minSizeRight = result.size() - 1;
+            } else {
+                minSizeLeft = minSizeMiddle + 1;
+            }
         }
     }
-    rightVariables.push_back(Minisat::mkLit(solver->newVar()));
 
-    // linkingVariables = leftVariables + rightVariables
-    for (unsigned sum = 0; sum <= linkingVariables.size()-2; sum++) {
-        for (unsigned a = 0; a <= leftVariables.size()-2; a++) {
-            unsigned b = sum - a;
-            if (b >= 0 && b <= rightVariables.size()-2) {
-                solver->addClause(~leftVariables[a], ~rightVariables[b], linkingVariables[sum]);
-                solver->addClause(leftVariables[a+1], rightVariables[b+1], ~linkingVariables[sum+1]);
+    // release the solver and its learnt clauses once the search is done
+    this->releaseSolver_CNF_SAT();
+
+    return result;
+}
+
+int Graph::getVertexCoverLowerBound() {
+    // Edges of a matching share no vertex, so each of them needs a different vertex in the cover
+    // A self loop not touching the matching needs its own vertex as well
+    std::vector<bool> isMatched(nVertex+1, false);
+    int lowerBound = 0;
+    for (int i = 1; i <= nVertex; i++) {
+        if (isMatched[i]) {
+            continue;
+        }
+        for (int j = adjOffsets[i]; j < adjOffsets[i+1]; j++) {
+            int neighbor = adjNeighbors[j];
+            if (!isMatched[neighbor]) {
+                isMatched[i] = true;
+                isMatched[neighbor] = true;
+                lowerBound++;
+                break;
             }
         }
     }
 
-    // recursion
-    this->appendSummationClauses_CNF_SAT(solver, leftVariables, inputVariables, left, middle);
-    this->appendSummationClauses_CNF_SAT(solver, rightVariables, inputVariables, middle+1, right);
+    return lowerBound;
 }
 
 /*
-    Encoding with https://www.cs.toronto.edu/~fbacchus/csc2512/Assignments/Bailleux-Boufkhad2003_Chapter_EfficientCNFEncodingOfBooleanC.pdf
+    Edge clauses and the cardinality constraint are only built once per graph, every probe reuses the same solver
 */
-bool Graph::getVertexCoverOfSize_CNF_SAT(int size, std::vector<int> &result) {
-    std::unique_ptr<Minisat::Solver> solver(new Minisat::Solver());
+void Graph::prepareSolver_CNF_SAT(int maxSize) {
+    this->cnfSolver = std::unique_ptr<Minisat::Solver>(new Minisat::Solver());
 
-    auto variables = std::vector<Minisat::Lit>();
-    variables.push_back(Minisat::Lit());
+    this->cnfVertexVariables = std::vector<Minisat::Lit>();
+    this->cnfVertexVariables.push_back(Minisat::Lit());
     for (int i = 1; i <= this->nVertex; i++) {
-        variables.push_back(Minisat::mkLit(solver->newVar()));
+        this->cnfVertexVariables.push_back(Minisat::mkLit(this->cnfSolver->newVar()));
     }
 
-    auto linkingVariables = std::vector<Minisat::Lit>();
-    for (int i = 0; i < this->nVertex + 2; i++) {
-        linkingVariables.push_back(Minisat::mkLit(solver->newVar()));
-    }
-
-    this->appendSummationClauses_CNF_SAT(solver, linkingVariables, variables, 1, nVertex);
-
-    // value of linkingVariables is equal to size
-    for (int i = 1;i <= size; i++) {
-        solver->addClause(linkingVariables[i]);
-    }
-    for (unsigned i = size+1;i < linkingVariables.size()-1; i++) {
-        solver->addClause(~linkingVariables[i]);
-    }
+    auto inputs = std::vector<Minisat::Lit>(this->cnfVertexVariables.begin() + 1, this->cnfVertexVariables.end());
+    this->cnfEncoder = CardinalityEncoder::Create(this->cardinalityEncoding, this->nVertex, maxSize);
+    this->cnfEncoder->Encode(*this->cnfSolver, inputs, maxSize);
 
     // edges
     for (int i = 1; i <= this->nVertex; i++) {
-        auto vertices = this->adjVertices[i];
-        for (auto iterator = vertices.begin(); iterator != vertices.end(); iterator++) {
-            if (*iterator >= i) {
-                auto clause = std::unique_ptr<Minisat::vec<Minisat::Lit>>(new Minisat::vec<Minisat::Lit>());
-                solver->addClause(variables[i], variables[*iterator]);
+        for (int j = this->adjOffsets[i]; j < this->adjOffsets[i+1]; j++) {
+            int neighbor = this->adjNeighbors[j];
+            if (neighbor >= i) {
+                this->cnfSolver->addClause(this->cnfVertexVariables[i], this->cnfVertexVariables[neighbor]);
             }
         }
     }
 
-    bool isSat = solver->solve();
-    if (!isSat) {
+    if (this->cancellationToken) {
+        this->cancellationToken->AttachSolver(this->cnfSolver.get());
+    }
+}
+
+void Graph::releaseSolver_CNF_SAT() {
+    if (this->cancellationToken && this->cnfSolver) {
+        this->cancellationToken->DetachSolver(this->cnfSolver.get());
+    }
+    this->cnfEncoder.reset();
+    this->cnfSolver.reset();
+}
+
+// Conflicts between two checks of the deadline, a few milliseconds of search
+const int conflictsPerDeadlineCheck = 1000;
+
+bool Graph::getVertexCoverOfSize_CNF_SAT(int size, std::vector<int> &result) {
+    // count of vertices is at most size, imposed as assumption so learnt clauses are kept for later probes
+    Minisat::vec<Minisat::Lit> assumptions;
+    this->cnfEncoder->AppendAtMostAssumptions(*this->cnfSolver, size, assumptions);
+
+    // an interrupted search has no answer, which only happens when the token is cancelled
+    bool hasDeadline = this->cancellationToken && this->cancellationToken->HasDeadline();
+    Minisat::lbool status = Minisat::l_Undef;
+    do {
+        if (hasDeadline) {
+            // nobody interrupts the solver at a deadline, so it runs in slices of conflicts and checks the clock in between
+            this->cnfSolver->setConfBudget(conflictsPerDeadlineCheck);
+        }
+        status = this->cnfSolver->solveLimited(assumptions);
+    } while (hasDeadline && Minisat::toInt(status) == Minisat::toInt(Minisat::l_Undef) && !this->cancellationToken->IsCancelled());
+
+    if (Minisat::toInt(status) == Minisat::toInt(Minisat::l_Undef)) {
+        this->releaseSolver_CNF_SAT();
+        throw OperationCancelled();
+    }
+    if (Minisat::toInt(status) == Minisat::toInt(Minisat::l_False)) {
         return false;
     }
 
@@ -168,7 +412,7 @@ bool Graph::getVertexCoverOfSize_CNF_SAT(int size, std::vector<int> &result) {
 
     // iterate from lowest index to highest so it is in ascending order
     for (int i = 1; i <= this->nVertex; i++) {
-        if (Minisat::toInt(solver->modelValue(variables[i])) == Minisat::toInt(Minisat::l_True)) {
+        if (Minisat::toInt(this->cnfSolver->modelValue(this->cnfVertexVariables[i])) == Minisat::toInt(Minisat::l_True)) {
             newResult.push_back(i);
         }
     }
@@ -177,50 +421,103 @@ bool Graph::getVertexCoverOfSize_CNF_SAT(int size, std::vector<int> &result) {
     return true;
 }
 
+void Graph::getVertexCoverWithAPPROX_VC_1(std::vector<int> &result){
+    this->solveByComponents(&Graph::solveWithAPPROX_VC_1, result);
+}
+
+void Graph::getVertexCoverWithAPPROX_VC_2(std::vector<int> &result){
+    this->solveByComponents(&Graph::solveWithAPPROX_VC_2, result);
+}
+
+void Graph::solveByComponents(void (Graph::*method)(std::vector<int> &), std::vector<int> &result) {
+    if (ComponentDecomposition::CountComponents(*this) <= 1) {
+        (this->*method)(result);
+        return;
+    }
+
+    ComponentDecomposition decomposition(*this);
+    auto componentCovers = std::vector<std::vector<int>>(decomposition.GetComponentCount());
+    ThreadPool::Shared().ParallelFor(decomposition.GetComponentCount(), [&](int index) {
+        (decomposition.GetComponent(index).*method)(componentCovers[index]);
+    });
+
+    result = decomposition.MergeCovers(componentCovers);
+}
+
 // 1. Pick a vertex of highest degree (most incident edges). Add it to your vertex cover and
 // throw away all edges incident on that vertex. Repeat till no edges remain. We will call
 // this algorithm APPROX-VC-1.
 
-void Graph::getVertexCoverWithAPPROX_VC_1(std::vector<int> &result){
+void Graph::solveWithAPPROX_VC_1(std::vector<int> &result){
     if (!this->hasEdges) {
         result = std::vector<int>();
         return;
     }
 
-    auto adjVertices = copyAdjVertices(this->adjVertices);
-
     std::vector<int> degree(nVertex+1,0);
+    std::vector<bool> isRemoved(nVertex+1,false);
     std::vector<int> vertexCover;
 
+    // Vertices are kept in buckets by degree, each bucket is a doubly linked list over the vertex arrays, 0 for none
+    int maxDegree = 0;
+    long long degreeSum = 0;
     for(int i=1;i<=nVertex;i++){
-        degree[i] = adjVertices[i].size();
+        degree[i] = adjOffsets[i+1] - adjOffsets[i];
+        maxDegree = std::max(maxDegree, degree[i]);
+        degreeSum += degree[i];
     }
-
-    while(true){
-        int maxDegree = 0;
-        int maxDegreeVertex = 0;
-        for(int i=1;i<=nVertex;i++){
-            if(degree[i]>maxDegree){
-                maxDegree = degree[i];
-                maxDegreeVertex = i;
-            }
+    std::vector<int> bucketHead(maxDegree+1,0);
+    std::vector<int> nextInBucket(nVertex+1,0);
+    std::vector<int> previousInBucket(nVertex+1,0);
+
+    auto insertToBucket = [&](int vertex) {
+        int head = bucketHead[degree[vertex]];
+        nextInBucket[vertex] = head;
+        previousInBucket[vertex] = 0;
+        if(head != 0){
+            previousInBucket[head] = vertex;
         }
-        vertexCover.push_back(maxDegreeVertex);
-        for(auto it = adjVertices[maxDegreeVertex].begin();it!=adjVertices[maxDegreeVertex].end();it++){
-            degree[*it]--;
-            adjVertices[*it].erase(maxDegreeVertex);
+        bucketHead[degree[vertex]] = vertex;
+    };
+    auto removeFromBucket = [&](int vertex) {
+        if(previousInBucket[vertex] != 0){
+            nextInBucket[previousInBucket[vertex]] = nextInBucket[vertex];
+        } else {
+            bucketHead[degree[vertex]] = nextInBucket[vertex];
         }
-        degree[maxDegreeVertex] = 0;
-
-        int sum = 0;
-        for (unsigned i = 1; i < degree.size(); ++i) {
-            sum += degree[i];
+        if(nextInBucket[vertex] != 0){
+            previousInBucket[nextInBucket[vertex]] = previousInBucket[vertex];
         }
+    };
 
-        if (sum == 0) {
-            break;
-        }
+    // inserted from highest index so that lowest index is picked first among the same initial degree,
+    // afterwards a vertex goes to the head of its new bucket, so ties go to the vertex whose degree changed last
+    for(int i=nVertex;i>=1;i--){
+        insertToBucket(i);
+    }
 
+    // degrees only decrease, so the highest non-empty bucket never moves up
+    while(degreeSum > 0){
+        while(bucketHead[maxDegree] == 0){
+            maxDegree--;
+        }
+        int maxDegreeVertex = bucketHead[maxDegree];
+        removeFromBucket(maxDegreeVertex);
+        vertexCover.push_back(maxDegreeVertex);
+        isRemoved[maxDegreeVertex] = true;
+
+        // edges to vertices already in the cover were thrown away before
+        for(int j=adjOffsets[maxDegreeVertex];j<adjOffsets[maxDegreeVertex+1];j++){
+            int neighbor = adjNeighbors[j];
+            if(!isRemoved[neighbor]){
+                removeFromBucket(neighbor);
+                degree[neighbor]--;
+                degreeSum--;
+                insertToBucket(neighbor);
+            }
+        }
+        degreeSum -= degree[maxDegreeVertex];
+        degree[maxDegreeVertex] = 0;
     }
 
     std::sort(vertexCover.begin(),vertexCover.end());
@@ -231,60 +528,53 @@ void Graph::getVertexCoverWithAPPROX_VC_1(std::vector<int> &result){
 // 2. Pick an edge ⟨u,v⟩, and add both u and v to your vertex cover. Throw away all edges
 // attached to u and v. Repeat till no edges remain. We will call this algorithm APPROXVC-2.
 
-std::tuple<int, int> getRandomPair(std::set<std::tuple<int, int>>& tupleSet) {
-    // Seed for the random number generator
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    
-    // Get an iterator to a random element in the set
-    auto randomIterator = std::next(std::begin(tupleSet), std::uniform_int_distribution<>(0, tupleSet.size() - 1)(gen));
-
-    // Dereference the iterator to get the randomly selected element
-    auto randomElement = *randomIterator;
-
-    return randomElement;
+// One generator per thread, seeded once and reused by every call on that thread
+std::mt19937 &getRandomGenerator() {
+    thread_local std::mt19937 generator(std::random_device{}());
+    return generator;
 }
 
-void Graph::getVertexCoverWithAPPROX_VC_2(std::vector<int> &result){
+void Graph::solveWithAPPROX_VC_2(std::vector<int> &result){
     if (!this->hasEdges) {
         result = std::vector<int>();
         return;
     }
 
-    auto adjVertices = copyAdjVertices(this->adjVertices);
-
-    std::vector<int> vertexCover;
+    std::vector<bool> isCovered(nVertex+1,false);
 
-    std::set<std::tuple<int, int>> tupleSet;
+    // each edge once, self loops included
+    std::vector<std::pair<int, int>> remainingEdges;
+    remainingEdges.reserve(adjOffsets[nVertex + 1] / 2 + 1);
     for (int i = 1; i <= nVertex; ++i) {
-        for (auto it = adjVertices[i].begin(); it != adjVertices[i].end(); ++it) {
-            tupleSet.insert(std::make_tuple(i, *it));
+        for (int j = adjOffsets[i]; j < adjOffsets[i+1]; ++j) {
+            if (adjNeighbors[j] >= i) {
+                remainingEdges.push_back(std::pair<int, int>(i, adjNeighbors[j]));
+            }
         }
     }
 
-    while(true){
-        std::tuple<int, int> randomEdge = getRandomPair(tupleSet);
-        tupleSet.erase(randomEdge);
-        tupleSet.erase(std::make_tuple(std::get<1>(randomEdge), std::get<0>(randomEdge)));
-        vertexCover.push_back(std::get<0>(randomEdge));
-        vertexCover.push_back(std::get<1>(randomEdge));
-        for(auto it = adjVertices[std::get<0>(randomEdge)].begin();it!=adjVertices[std::get<0>(randomEdge)].end();it++){
-            adjVertices[*it].erase(std::get<0>(randomEdge));
-            tupleSet.erase(std::make_tuple(*it, std::get<0>(randomEdge)));
-            tupleSet.erase(std::make_tuple(std::get<0>(randomEdge), *it));
-        }
-        for(auto it = adjVertices[std::get<1>(randomEdge)].begin();it!=adjVertices[std::get<1>(randomEdge)].end();it++){
-            adjVertices[*it].erase(std::get<1>(randomEdge));
-            tupleSet.erase(std::make_tuple(*it, std::get<1>(randomEdge)));
-            tupleSet.erase(std::make_tuple(std::get<1>(randomEdge), *it));
+    auto &generator = getRandomGenerator();
+    while(!remainingEdges.empty()){
+        // swap the picked edge to the end and drop it
+        size_t index = std::uniform_int_distribution<size_t>(0, remainingEdges.size() - 1)(generator);
+        std::pair<int, int> randomEdge = remainingEdges[index];
+        remainingEdges[index] = remainingEdges.back();
+        remainingEdges.pop_back();
+
+        // edges attached to covered vertices are thrown away lazily when they are picked
+        if (isCovered[randomEdge.first] || isCovered[randomEdge.second]) {
+            continue;
         }
+        isCovered[randomEdge.first] = true;
+        isCovered[randomEdge.second] = true;
+    }
 
-        if (tupleSet.size() == 0) {
-            break;
+    // scanning the flags gives the cover in ascending order
+    std::vector<int> vertexCover;
+    for (int i = 1; i <= nVertex; ++i) {
+        if (isCovered[i]) {
+            vertexCover.push_back(i);
         }
-
     }
-
-    std::sort(vertexCover.begin(),vertexCover.end());
     result = vertexCover;
 }
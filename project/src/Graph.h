@@ -4,6 +4,7 @@
 #include <set>
 #include <vector>
 #include <tuple>
+#include <functional>
 #include <memory>
 #include <random>
 #include <algorithm>
@@ -13,9 +14,12 @@
 #include "minisat/core/SolverTypes.h"
 #include "minisat/core/Solver.h"
 
+#include "CancellationToken.h"
+#include "CardinalityEncoder.h"
+
 /*
-Graph represented with adjancent list.
-List are represented with set to automatically ignore duplicate edges.
+Graph represented with adjancent list in compressed sparse row (CSR) form.
+Neighbors of every vertex are stored sorted and without duplicates in one contiguous array.
 */
 class Graph {
 public:
@@ -25,7 +29,37 @@ public:
         nVertex is greater than 1
         Vertex index in edges are in range [1, nVertex]
     */
-    Graph(int nVertex, std::vector<std::pair<int, int>> edges);
+    Graph(int nVertex, const std::vector<std::pair<int, int>> &edges);
+
+    /*
+    Constructor with CSR arrays owned by storage, in the same form as the graph keeps them, see adjOffsets and adjNeighbors
+    The arrays are used in place without copying. storage is kept alive as long as the graph
+    Throws if the arrays are not a valid CSR form: offsets not ascending, neighbors out of range, not sorted, duplicated, or not symmetric
+    */
+    Graph(int nVertex, const int *adjOffsets, const int *adjNeighbors, const std::shared_ptr<const void> &storage);
+
+    /*
+    Return count of vertices
+    */
+    int GetVertexCount() const;
+
+    /*
+    Return neighbors of vertex in ascending order as range [begin, end), a self loop is included once
+    */
+    const int *GetNeighborsBegin(int vertex) const;
+    const int *GetNeighborsEnd(int vertex) const;
+
+    /*
+    Return true if cover has vertices in range [1, vertex count] only, and every edge has a vertex in cover
+    */
+    bool IsVertexCover(const std::vector<int> &cover) const;
+
+    /*
+    Return true if cover is a vertex cover in ascending order without duplicates, no larger than knownCover if it is not empty,
+    and no larger than twice the matching lower bound, since the matched vertices are a cover themselves
+    A cover failing this is not minimal, such as a damaged or outdated record of a cache
+    */
+    bool IsMinimalVertexCoverCandidate(const std::vector<int> &cover, const std::vector<int> &knownCover);
 
     /*
     Return minimal vertex cover with CNF SAT method
@@ -33,12 +67,49 @@ public:
     std::vector<int> GetMinimalVertexCover_CNF_SAT();
 
     /*
-    Return minimal vertex cover with Approx 1 method
+    Return minimal vertex cover with CNF SAT method, starting from a known cover as the upper bound of the search
+    knownCover is any vertex cover of the graph, e.g. result of Approx methods. It is ignored if empty
+    The graph is reduced to a kernel first, and connected components of the kernel are solved with CNF SAT in parallel
+    */
+    std::vector<int> GetMinimalVertexCover_CNF_SAT(const std::vector<int> &knownCover);
+
+    /*
+    Same as GetMinimalVertexCover_CNF_SAT, with each component solved by BranchAndBoundSolver instead of CNF SAT
+    */
+    std::vector<int> GetMinimalVertexCover_BranchAndBound(const std::vector<int> &knownCover);
+
+    /*
+    Solve kernel components with a solver suiting their structure, whichever exact method is called:
+        ForestSolver for a forest, before it is reduced to a kernel at all,
+        BipartiteSolver for a bipartite component, TreeDecompositionSolver for one of treewidth at most the maximum,
+        CliqueSolver for a dense one, BitsetSolver for one of at most BitsetSolver::maxVertexCount vertices
+    Off by default, so each exact method solves every component itself
+    */
+    void SetFastPaths(bool isFastPathEnabled);
+
+    /*
+    Select the largest treewidth of components solved by TreeDecompositionSolver with fast paths enabled,
+    TreeDecompositionSolver::defaultMaxWidth by default
+    */
+    void SetMaxTreewidth(int maxTreewidth);
+
+    /*
+    Select the cardinality encoding used by CNF SAT method, chosen by graph size and bound by default
+    */
+    void SetCardinalityEncoding(CardinalityEncoding encoding);
+
+    /*
+    Cancel CNF SAT method with token, it throws OperationCancelled once the token is cancelled
+    */
+    void SetCancellationToken(const std::shared_ptr<CancellationToken> &token);
+
+    /*
+    Return minimal vertex cover with Approx 1 method, connected components are solved in parallel
     */
     void getVertexCoverWithAPPROX_VC_1(std::vector<int> &result);
 
     /*
-    Return minimal vertex cover with Approx 2 method
+    Return minimal vertex cover with Approx 2 method, connected components are solved in parallel
     */
     void getVertexCoverWithAPPROX_VC_2(std::vector<int> &result);
 
@@ -49,19 +120,91 @@ private:
     // Indicates whether there are edges in the graph
     bool hasEdges;
 
-    // Adjancent list(set) with size equal to nVertex + 1. To avoid vertex index shiftting by ignoring the first element
-    std::vector<std::set<int>> adjVertices;
+    // Neighbors of vertex v are adjNeighbors[adjOffsets[v]] to adjNeighbors[adjOffsets[v+1]-1], sorted in ascending order
+    // adjOffsets has size nVertex + 2. To avoid vertex index shiftting the first element is ignored
+    const int *adjOffsets;
+
+    // Concatenated neighbor lists of all vertices, a self loop appears once in the list of its vertex
+    const int *adjNeighbors;
+
+    // Arrays of adjOffsets and adjNeighbors when built by the graph itself
+    std::vector<int> adjOffsetsStorage;
+    std::vector<int> adjNeighborsStorage;
+
+    // Keeps arrays of adjOffsets and adjNeighbors alive when they are owned by someone else, e.g. a mapped file
+    std::shared_ptr<const void> externalStorage;
+
+    // Cardinality encoding used by CNF SAT method
+    CardinalityEncoding cardinalityEncoding;
+
+    // Indicates whether kernel components are solved with a solver suiting their structure when there is one
+    bool isFastPathEnabled;
+
+    // Largest treewidth of components solved by TreeDecompositionSolver
+    int maxTreewidth;
+
+    // Token to cancel CNF SAT method, not cancellable if null
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    // Persistent solver of CNF SAT method, shared by all probes of one search
+    std::unique_ptr<Minisat::Solver> cnfSolver;
+
+    // Solver literal of each vertex, true if the vertex is in the cover. The first element is ignored
+    std::vector<Minisat::Lit> cnfVertexVariables;
+
+    // Cardinality constraint on count of vertices in the cover
+    std::unique_ptr<CardinalityEncoder> cnfEncoder;
+
+    /*
+    Approx 1 and Approx 2 methods on this graph as a whole
+    */
+    void solveWithAPPROX_VC_1(std::vector<int> &result);
+    void solveWithAPPROX_VC_2(std::vector<int> &result);
+
+    /*
+    Run method on every connected component in parallel and merge the covers, or on this graph directly if it is connected
+    */
+    void solveByComponents(void (Graph::*method)(std::vector<int> &), std::vector<int> &result);
+
+    /*
+    Reduce this graph to a kernel, solve every connected component of the kernel in parallel with solveComponent, and lift the covers back
+    With fast paths enabled, a forest is solved directly, and a component by solveComponentWithFastPath instead if it suits one
+    solveComponent returns a minimal vertex cover of a component, given the Approx 1 cover of it
+    */
+    std::vector<int> solveKernelComponents(const std::vector<int> &knownCover,
+        const std::function<std::vector<int>(Graph &, const std::vector<int> &)> &solveComponent);
+
+    /*
+    Return true and set cover to a minimal vertex cover of component, if a solver suits its structure, starting from knownCover
+    */
+    bool solveComponentWithFastPath(Graph &component, const std::vector<int> &knownCover, std::vector<int> &cover);
+
+    /*
+    Return minimal vertex cover of this graph itself with CNF SAT method, starting from knownCover as the upper bound
+    */
+    std::vector<int> solveMinimalVertexCover_CNF_SAT(const std::vector<int> &knownCover);
+
+    /*
+    Return lower bound of the minimal vertex cover size, with a maximal matching
+    */
+    int getVertexCoverLowerBound();
+
+    /*
+    Create the persistent solver with edge clauses and summation clauses, without any constraint on cover size
+    Cover sizes up to maxSize can be probed afterwards
+    */
+    void prepareSolver_CNF_SAT(int maxSize);
 
     /*
-    Get vertex cover of specific size with result in ascending order of vertex index
+    Get vertex cover of at most specific size with result in ascending order of vertex index
     If the cover exists, set it in result and return true, otherwise return false
     */
     bool getVertexCoverOfSize_CNF_SAT(int size, std::vector<int> &result);
 
     /*
-    Append summation clauses for inputVariables ranges in [left, right], with its corresponding linkingVariables
+    Detach the persistent solver from the cancellation token and release it
     */
-    void appendSummationClauses_CNF_SAT(const std::unique_ptr<Minisat::Solver> &solver, const std::vector<Minisat::Lit> &linkingVariables, const std::vector<Minisat::Lit> &inputVariables, int left, int right);
+    void releaseSolver_CNF_SAT();
 };
 
 #endif
@@ -0,0 +1,164 @@
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "GraphFile.h"
+
+const char graphFileMagic[8] = {'V', 'C', 'G', 'R', 'A', 'P', 'H', '\0'};
+const uint32_t graphFileHasChecksum = 1;
+
+struct GraphFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    int64_t nVertex;
+    int64_t nNeighbors;
+    uint64_t checksum;
+};
+
+// 64-bit FNV-1a over bytes, continuing from hash
+uint64_t hashBytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+const uint64_t hashOffsetBasis = 14695981039346656037ULL;
+
+bool isLittleEndian() {
+    const uint16_t value = 1;
+    return *(const unsigned char*)&value == 1;
+}
+
+// Read-only mapping of a whole file, unmapped on destruction
+class MappedFile {
+public:
+    explicit MappedFile(const std::string &path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("not able to open graph file " + path);
+        }
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0) {
+            close(fd);
+            throw std::runtime_error("not able to open graph file " + path);
+        }
+        this->size = fileStat.st_size;
+        this->data = nullptr;
+        if (this->size > 0) {
+            this->data = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (this->data == MAP_FAILED || this->data == nullptr) {
+            throw std::runtime_error("not able to map graph file " + path);
+        }
+    }
+
+    ~MappedFile() {
+        munmap(this->data, this->size);
+    }
+
+    const char *GetData() const {
+        return (const char*)this->data;
+    }
+
+    size_t GetSize() const {
+        return this->size;
+    }
+
+private:
+    void *data;
+    size_t size;
+};
+
+void WriteGraphFile(const Graph &graph, const std::string &path, bool withChecksum) {
+    if (!isLittleEndian()) {
+        throw std::runtime_error("graph files are only supported on little endian machines");
+    }
+
+    int nVertex = graph.GetVertexCount();
+    auto offsets = std::vector<int32_t>(nVertex + 2, 0);
+    for (int i = 1; i <= nVertex; i++) {
+        offsets[i + 1] = offsets[i] + (graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i));
+    }
+
+    GraphFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, graphFileMagic, sizeof(header.magic));
+    header.version = GRAPH_FILE_VERSION;
+    header.nVertex = nVertex;
+    header.nNeighbors = offsets[nVertex + 1];
+    if (withChecksum) {
+        header.flags |= graphFileHasChecksum;
+        uint64_t hash = hashBytes(hashOffsetBasis, offsets.data(), offsets.size() * sizeof(int32_t));
+        for (int i = 1; i <= nVertex; i++) {
+            hash = hashBytes(hash, graph.GetNeighborsBegin(i), (graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i)) * sizeof(int32_t));
+        }
+        header.checksum = hash;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)offsets.data(), offsets.size() * sizeof(int32_t));
+    for (int i = 1; i <= nVertex; i++) {
+        file.write((const char*)graph.GetNeighborsBegin(i), (graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i)) * sizeof(int32_t));
+    }
+    file.close();
+    if (!file) {
+        throw std::runtime_error("not able to write graph file " + path);
+    }
+}
+
+std::shared_ptr<Graph> OpenGraphFile(const std::string &path, bool verifyChecksum) {
+    if (!isLittleEndian()) {
+        throw std::runtime_error("graph files are only supported on little endian machines");
+    }
+
+    auto file = std::make_shared<MappedFile>(path);
+    const char *data = file->GetData();
+    size_t size = file->GetSize();
+
+    GraphFileHeader header;
+    if (size < sizeof(header)) {
+        throw std::runtime_error("not a graph file " + path);
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, graphFileMagic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("not a graph file " + path);
+    }
+    if (header.version != GRAPH_FILE_VERSION) {
+        throw std::runtime_error("unsupported graph file version " + std::to_string(header.version) + " of " + path);
+    }
+    if (header.nVertex < 0 || header.nVertex > INT32_MAX - 2 || header.nNeighbors < 0 || header.nNeighbors > INT32_MAX
+        || size != sizeof(header) + (header.nVertex + 2 + header.nNeighbors) * sizeof(int32_t)) {
+        throw std::runtime_error("graph file of wrong size " + path);
+    }
+
+    const int32_t *offsets = (const int32_t*)(data + sizeof(header));
+    const int32_t *neighbors = offsets + header.nVertex + 2;
+    if (verifyChecksum && (header.flags & graphFileHasChecksum)) {
+        uint64_t hash = hashBytes(hashOffsetBasis, offsets, (header.nVertex + 2 + header.nNeighbors) * sizeof(int32_t));
+        if (hash != header.checksum) {
+            throw std::runtime_error("wrong checksum of graph file " + path);
+        }
+    }
+    if (offsets[header.nVertex + 1] != header.nNeighbors) {
+        throw std::runtime_error("invalid graph file " + path);
+    }
+
+    try {
+        return std::make_shared<Graph>(header.nVertex, offsets, neighbors, file);
+    }
+    catch (std::invalid_argument &e) {
+        throw std::runtime_error("invalid graph file " + path + ": " + e.what());
+    }
+}
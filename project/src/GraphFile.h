@@ -0,0 +1,35 @@
+#ifndef GRAPH_FILE_H
+#define GRAPH_FILE_H
+
+#include <memory>
+#include <string>
+
+#include "Graph.h"
+
+/*
+Binary graph file, opened with mmap and used in place without parsing. All fields are little endian
+    char     magic[8]           "VCGRAPH\0"
+    uint32   version            GRAPH_FILE_VERSION
+    uint32   flags              bit 0 set if checksum is valid
+    int64    vertex count       n
+    int64    neighbor count     m, twice the edge count minus self loops
+    uint64   checksum           FNV-1a of the two arrays below, if flag bit 0 is set
+    int32    offsets[n + 2]     CSR offsets in the form of Graph, the first element is ignored
+    int32    neighbors[m]       CSR neighbors, sorted per vertex
+*/
+const unsigned GRAPH_FILE_VERSION = 1;
+
+/*
+Write graph to path, with checksum if withChecksum
+Throws std::runtime_error if the file cannot be written
+*/
+void WriteGraphFile(const Graph &graph, const std::string &path, bool withChecksum);
+
+/*
+Map graph file at path and return graph using the mapped arrays, the mapping is released with the graph
+The checksum is verified if verifyChecksum and the file has one. The CSR form is always validated
+Throws std::runtime_error if the file cannot be read, is not a graph file, has another version or a wrong checksum
+*/
+std::shared_ptr<Graph> OpenGraphFile(const std::string &path, bool verifyChecksum);
+
+#endif
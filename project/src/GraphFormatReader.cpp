@@ -0,0 +1,423 @@
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+#include "GraphFormatReader.h"
+#include "Parser.h"
+
+GraphFormat ParseGraphFormat(const std::string &name) {
+    if (name == "commands") {
+        return GraphFormat::Commands;
+    }
+    if (name == "dimacs") {
+        return GraphFormat::DIMACS;
+    }
+    if (name == "metis") {
+        return GraphFormat::METIS;
+    }
+    if (name == "snap") {
+        return GraphFormat::SNAP;
+    }
+    if (name == "mtx") {
+        return GraphFormat::MatrixMarket;
+    }
+    throw std::invalid_argument("unknown graph format");
+}
+
+bool isFieldSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Whitespace separated fields of a line
+class FieldCursor {
+public:
+    FieldCursor(const char *begin, const char *end) {
+        this->current = begin;
+        this->end = end;
+    }
+
+    /*
+    Set [fieldBegin, fieldEnd) to the next field
+    Return false if there are no more fields
+    */
+    bool Next(const char *&fieldBegin, const char *&fieldEnd) {
+        if (this->IsEnd()) {
+            return false;
+        }
+        fieldBegin = this->current;
+        while (this->current != this->end && !isFieldSpace(*this->current)) {
+            this->current++;
+        }
+        fieldEnd = this->current;
+        return true;
+    }
+
+    /*
+    Read the next field as a non-negative int
+    Return false if there are no more fields or the field is not an int
+    */
+    bool NextInt(int &value) {
+        const char *fieldBegin, *fieldEnd;
+        if (!this->Next(fieldBegin, fieldEnd)) {
+            return false;
+        }
+        IntAccumulator number;
+        for (const char *c = fieldBegin; c != fieldEnd; c++) {
+            number.Push(*c);
+        }
+        value = number.GetValue();
+        return number.IsValidInt();
+    }
+
+    bool IsEnd() {
+        while (this->current != this->end && isFieldSpace(*this->current)) {
+            this->current++;
+        }
+        return this->current == this->end;
+    }
+
+private:
+    const char *current;
+    const char *end;
+};
+
+// Return true if line has only spaces, or its first other character is commentMark
+bool isBlankOrComment(const char *begin, const char *end, char commentMark) {
+    FieldCursor fields(begin, end);
+    return fields.IsEnd() || *std::find_if_not(begin, end, isFieldSpace) == commentMark;
+}
+
+// Return true if field equals word, ignoring case
+bool isFieldWord(const char *fieldBegin, const char *fieldEnd, const char *word) {
+    size_t length = std::strlen(word);
+    if ((size_t)(fieldEnd - fieldBegin) != length) {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (std::tolower((unsigned char)fieldBegin[i]) != word[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+GraphFormatReader::GraphFormatReader(std::istream &input, int bufferSize) : input(input), buffer(std::max(1, bufferSize)) {
+    this->dataBegin = 0;
+    this->dataEnd = 0;
+    this->isEndOfInput = false;
+    this->lineNumber = 0;
+}
+
+std::shared_ptr<Graph> GraphFormatReader::Read(GraphFormat format) {
+    switch (format) {
+    case GraphFormat::DIMACS:
+        return this->readDIMACS();
+    case GraphFormat::METIS:
+        return this->readMETIS();
+    case GraphFormat::SNAP:
+        return this->readSNAP();
+    case GraphFormat::MatrixMarket:
+        return this->readMatrixMarket();
+    default:
+        throw std::invalid_argument("commands are not read as a single graph");
+    }
+}
+
+std::shared_ptr<Graph> GraphFormatReader::GetComplement(const Graph &graph) {
+    int nVertex = graph.GetVertexCount();
+    auto isNeighbor = std::vector<bool>(nVertex + 1, false);
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= nVertex; i++) {
+        for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+            isNeighbor[*neighbor] = true;
+        }
+        for (int j = i + 1; j <= nVertex; j++) {
+            if (!isNeighbor[j]) {
+                edges.push_back(std::pair<int, int>(i, j));
+            }
+        }
+        for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+            isNeighbor[*neighbor] = false;
+        }
+    }
+    return std::make_shared<Graph>(nVertex, edges);
+}
+
+bool GraphFormatReader::nextLine(const char *&begin, const char *&end) {
+    while (true) {
+        char *data = this->buffer.data();
+        char *newline = (char*)std::memchr(data + this->dataBegin, '\n', this->dataEnd - this->dataBegin);
+        if (newline != nullptr) {
+            begin = data + this->dataBegin;
+            end = newline;
+            this->dataBegin = newline + 1 - data;
+            this->lineNumber++;
+            return true;
+        }
+
+        if (this->isEndOfInput) {
+            break;
+        }
+        this->fillBuffer();
+    }
+
+    if (this->dataBegin == this->dataEnd) {
+        // nothing after the last newline
+        return false;
+    }
+
+    // last line without newline
+    begin = this->buffer.data() + this->dataBegin;
+    end = this->buffer.data() + this->dataEnd;
+    this->dataBegin = this->dataEnd;
+    this->lineNumber++;
+    return true;
+}
+
+bool GraphFormatReader::fillBuffer() {
+    if (this->dataBegin > 0) {
+        std::memmove(this->buffer.data(), this->buffer.data() + this->dataBegin, this->dataEnd - this->dataBegin);
+        this->dataEnd -= this->dataBegin;
+        this->dataBegin = 0;
+    }
+    if (this->dataEnd == (int)this->buffer.size()) {
+        // a line longer than buffer, such as the neighbors of a vertex of high degree in METIS
+        this->buffer.resize(this->buffer.size() * 2);
+    }
+
+    this->input.read(this->buffer.data() + this->dataEnd, this->buffer.size() - this->dataEnd);
+    int nRead = this->input.gcount();
+    this->dataEnd += nRead;
+    if (nRead == 0) {
+        this->isEndOfInput = true;
+    }
+    return nRead > 0;
+}
+
+void GraphFormatReader::throwError(const std::string &message) const {
+    if (this->lineNumber == 0) {
+        throw std::invalid_argument(message + " on empty input");
+    }
+    throw std::invalid_argument(message + " at line " + std::to_string(this->lineNumber));
+}
+
+std::shared_ptr<Graph> GraphFormatReader::readDIMACS() {
+    int nVertex = 0;
+    int nEdge = 0;
+    auto edges = std::vector<std::pair<int, int>>();
+
+    const char *lineBegin, *lineEnd;
+    while (this->nextLine(lineBegin, lineEnd)) {
+        FieldCursor fields(lineBegin, lineEnd);
+        const char *typeBegin, *typeEnd;
+        if (!fields.Next(typeBegin, typeEnd) || isFieldWord(typeBegin, typeEnd, "c")) {
+            continue;
+        }
+
+        if (isFieldWord(typeBegin, typeEnd, "p")) {
+            // "p edge n m", the format word differs between benchmark sets
+            const char *formatBegin, *formatEnd;
+            if (nVertex > 0) {
+                this->throwError("duplicate problem line when parsing DIMACS");
+            }
+            if (!fields.Next(formatBegin, formatEnd) || !fields.NextInt(nVertex) || !fields.NextInt(nEdge) || nVertex < 1) {
+                this->throwError("wrong format when parsing DIMACS problem line");
+            }
+        }
+        else if (isFieldWord(typeBegin, typeEnd, "e")) {
+            int vertex_1, vertex_2;
+            if (nVertex == 0) {
+                this->throwError("edge before problem line when parsing DIMACS");
+            }
+            if (!fields.NextInt(vertex_1) || !fields.NextInt(vertex_2)) {
+                this->throwError("not able to convert vertex index to int when parsing DIMACS edge");
+            }
+            if (vertex_1 < 1 || vertex_1 > nVertex || vertex_2 < 1 || vertex_2 > nVertex) {
+                this->throwError("vertex index out of range when parsing DIMACS edge");
+            }
+            edges.push_back(std::pair<int, int>(vertex_1, vertex_2));
+        }
+        else {
+            this->throwError("unknown line type when parsing DIMACS");
+        }
+    }
+
+    if (nVertex == 0) {
+        this->throwError("missing problem line when parsing DIMACS");
+    }
+    if ((int)edges.size() != nEdge) {
+        this->throwError("edge count differs from the problem line when parsing DIMACS");
+    }
+    return std::make_shared<Graph>(nVertex, edges);
+}
+
+std::shared_ptr<Graph> GraphFormatReader::readMETIS() {
+    const char *lineBegin, *lineEnd;
+    do {
+        if (!this->nextLine(lineBegin, lineEnd)) {
+            this->throwError("missing header when parsing METIS");
+        }
+    } while (isBlankOrComment(lineBegin, lineEnd, '%'));
+
+    // "n m [fmt [ncon]]", fmt flags vertex sizes, vertex weights and edge weights from left to right
+    FieldCursor header(lineBegin, lineEnd);
+    int nVertex, nEdge;
+    if (!header.NextInt(nVertex) || !header.NextInt(nEdge) || nVertex < 1) {
+        this->throwError("wrong format when parsing METIS header");
+    }
+    bool hasVertexSize = false, hasVertexWeights = false, hasEdgeWeights = false;
+    int nConstraint = 1;
+    const char *formatBegin, *formatEnd;
+    if (header.Next(formatBegin, formatEnd)) {
+        int formatLength = formatEnd - formatBegin;
+        if (formatLength > 3 || std::find_if(formatBegin, formatEnd, [](char c) { return c != '0' && c != '1'; }) != formatEnd) {
+            this->throwError("unknown fmt when parsing METIS header");
+        }
+        hasVertexSize = formatLength >= 3 && formatEnd[-3] == '1';
+        hasVertexWeights = formatLength >= 2 && formatEnd[-2] == '1';
+        hasEdgeWeights = formatEnd[-1] == '1';
+        if (!header.IsEnd() && (!header.NextInt(nConstraint) || nConstraint < 1)) {
+            this->throwError("wrong ncon when parsing METIS header");
+        }
+    }
+
+    // every vertex has a line, which is empty without neighbors, so only comments are skipped
+    // each edge is listed by both of its vertices
+    auto edges = std::vector<std::pair<int, int>>();
+    int vertex = 0;
+    while (vertex < nVertex && this->nextLine(lineBegin, lineEnd)) {
+        if (!FieldCursor(lineBegin, lineEnd).IsEnd() && isBlankOrComment(lineBegin, lineEnd, '%')) {
+            continue;
+        }
+        vertex++;
+
+        FieldCursor fields(lineBegin, lineEnd);
+        int value;
+        int nSkipped = (hasVertexSize ? 1 : 0) + (hasVertexWeights ? nConstraint : 0);
+        for (int i = 0; i < nSkipped; i++) {
+            if (!fields.NextInt(value)) {
+                this->throwError("not able to convert vertex weight to int when parsing METIS");
+            }
+        }
+        while (!fields.IsEnd()) {
+            int neighbor;
+            if (!fields.NextInt(neighbor)) {
+                this->throwError("not able to convert vertex index to int when parsing METIS");
+            }
+            if (neighbor < 1 || neighbor > nVertex) {
+                this->throwError("vertex index out of range when parsing METIS");
+            }
+            if (hasEdgeWeights && !fields.NextInt(value)) {
+                this->throwError("not able to convert edge weight to int when parsing METIS");
+            }
+            edges.push_back(std::pair<int, int>(vertex, neighbor));
+        }
+    }
+
+    if (vertex < nVertex) {
+        this->throwError("missing vertex lines when parsing METIS");
+    }
+    if ((long long)edges.size() != 2LL * nEdge) {
+        this->throwError("edge count differs from the header when parsing METIS");
+    }
+    while (this->nextLine(lineBegin, lineEnd)) {
+        if (!isBlankOrComment(lineBegin, lineEnd, '%')) {
+            this->throwError("unexpected line after the last vertex when parsing METIS");
+        }
+    }
+    return std::make_shared<Graph>(nVertex, edges);
+}
+
+std::shared_ptr<Graph> GraphFormatReader::readSNAP() {
+    int maxVertexId = -1;
+    auto edges = std::vector<std::pair<int, int>>();
+
+    const char *lineBegin, *lineEnd;
+    while (this->nextLine(lineBegin, lineEnd)) {
+        if (isBlankOrComment(lineBegin, lineEnd, '#')) {
+            continue;
+        }
+
+        // fields after the two vertices, such as timestamps, are ignored
+        FieldCursor fields(lineBegin, lineEnd);
+        int vertexId_1, vertexId_2;
+        if (!fields.NextInt(vertexId_1) || !fields.NextInt(vertexId_2)) {
+            this->throwError("not able to convert vertex id to int when parsing SNAP edge");
+        }
+        if (std::max(vertexId_1, vertexId_2) > INT_MAX - 3) {
+            this->throwError("vertex id out of range when parsing SNAP edge");
+        }
+        maxVertexId = std::max(maxVertexId, std::max(vertexId_1, vertexId_2));
+        edges.push_back(std::pair<int, int>(vertexId_1 + 1, vertexId_2 + 1));
+    }
+
+    if (maxVertexId < 0) {
+        this->throwError("no edges when parsing SNAP");
+    }
+    return std::make_shared<Graph>(maxVertexId + 1, edges);
+}
+
+std::shared_ptr<Graph> GraphFormatReader::readMatrixMarket() {
+    const char *lineBegin, *lineEnd;
+    if (!this->nextLine(lineBegin, lineEnd)) {
+        this->throwError("missing header when parsing Matrix Market");
+    }
+
+    // "%%MatrixMarket matrix coordinate <field> <symmetry>", values and symmetry do not change the edges
+    FieldCursor header(lineBegin, lineEnd);
+    const char *fieldBegin, *fieldEnd;
+    if (!header.Next(fieldBegin, fieldEnd) || !isFieldWord(fieldBegin, fieldEnd, "%%matrixmarket")) {
+        this->throwError("wrong format when parsing Matrix Market header");
+    }
+    if (!header.Next(fieldBegin, fieldEnd) || !isFieldWord(fieldBegin, fieldEnd, "matrix")
+        || !header.Next(fieldBegin, fieldEnd) || !isFieldWord(fieldBegin, fieldEnd, "coordinate")) {
+        this->throwError("only coordinate matrices are supported when parsing Matrix Market header");
+    }
+
+    do {
+        if (!this->nextLine(lineBegin, lineEnd)) {
+            this->throwError("missing size line when parsing Matrix Market");
+        }
+    } while (isBlankOrComment(lineBegin, lineEnd, '%'));
+
+    FieldCursor size(lineBegin, lineEnd);
+    int nRow, nColumn, nEntry;
+    if (!size.NextInt(nRow) || !size.NextInt(nColumn) || !size.NextInt(nEntry) || nRow < 1) {
+        this->throwError("wrong format when parsing Matrix Market size line");
+    }
+    if (nRow != nColumn) {
+        this->throwError("matrix is not square when parsing Matrix Market size line");
+    }
+
+    auto edges = std::vector<std::pair<int, int>>();
+    int entry = 0;
+    while (this->nextLine(lineBegin, lineEnd)) {
+        if (isBlankOrComment(lineBegin, lineEnd, '%')) {
+            continue;
+        }
+        if (entry == nEntry) {
+            this->throwError("more entries than the size line when parsing Matrix Market");
+        }
+        entry++;
+
+        FieldCursor fields(lineBegin, lineEnd);
+        int row, column;
+        if (!fields.NextInt(row) || !fields.NextInt(column)) {
+            this->throwError("not able to convert index to int when parsing Matrix Market entry");
+        }
+        if (row < 1 || row > nRow || column < 1 || column > nColumn) {
+            this->throwError("index out of range when parsing Matrix Market entry");
+        }
+        // the diagonal holds values of the vertices themselves, not self loops
+        if (row != column) {
+            edges.push_back(std::pair<int, int>(row, column));
+        }
+    }
+
+    if (entry < nEntry) {
+        this->throwError("fewer entries than the size line when parsing Matrix Market");
+    }
+    return std::make_shared<Graph>(nRow, edges);
+}
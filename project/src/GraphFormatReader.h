@@ -0,0 +1,88 @@
+#ifndef GRAPH_FORMAT_READER_H
+#define GRAPH_FORMAT_READER_H
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Graph.h"
+
+enum class GraphFormat {
+    // V and E commands of the course, read by InputReader instead
+    Commands,
+    // DIMACS graph coloring and clique instances, "p edge n m" followed by "e u v" lines, vertices from 1
+    DIMACS,
+    // METIS graph file, "n m [fmt [ncon]]" followed by the neighbors of each vertex on its own line, vertices from 1
+    METIS,
+    // SNAP edge list, "u v" lines with '#' comments, vertices from 0 and numbered from 1 in the graph
+    SNAP,
+    // Matrix Market coordinate matrix, every off-diagonal entry "i j [value]" is an edge, vertices from 1
+    MatrixMarket
+};
+
+/*
+Return graph format of name, one of commands, dimacs, metis, snap and mtx
+Throws std::invalid_argument if name is unknown
+*/
+GraphFormat ParseGraphFormat(const std::string &name);
+
+/*
+Read a single graph in one of the standard formats from an input stream through a buffer
+Lines are parsed in place, the buffer only grows for a line longer than itself
+*/
+class GraphFormatReader {
+public:
+    explicit GraphFormatReader(std::istream &input, int bufferSize = 1 << 20);
+
+    /*
+    Read the whole input as a graph of format
+    Throws std::invalid_argument with the line number if the input is not valid, including an edge count other than that of the header,
+    or if format is GraphFormat::Commands
+    */
+    std::shared_ptr<Graph> Read(GraphFormat format);
+
+    /*
+    Return the graph with an edge between every two distinct vertices not adjacent in graph
+    Clique benchmarks become vertex cover instances this way, since a maximum clique is the complement of a minimum vertex cover of the complement graph
+    */
+    static std::shared_ptr<Graph> GetComplement(const Graph &graph);
+
+private:
+    std::istream &input;
+
+    // Unread data is buffer[dataBegin, dataEnd)
+    std::vector<char> buffer;
+    int dataBegin;
+    int dataEnd;
+
+    bool isEndOfInput;
+
+    // Number of the line returned last by nextLine, from 1
+    int lineNumber;
+
+    /*
+    Set [begin, end) to the next line without the line break, valid until the next call
+    Return false if there are no more lines
+    */
+    bool nextLine(const char *&begin, const char *&end);
+
+    /*
+    Move unread data to the front of buffer and read more after it, growing buffer if it is full
+    Return false if nothing more is read
+    */
+    bool fillBuffer();
+
+    // Throw std::invalid_argument with message and the current line number, or as empty input before the first line
+    void throwError(const std::string &message) const;
+
+    std::shared_ptr<Graph> readDIMACS();
+
+    std::shared_ptr<Graph> readMETIS();
+
+    std::shared_ptr<Graph> readSNAP();
+
+    std::shared_ptr<Graph> readMatrixMarket();
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include <cstring>
+
+#include "InputReader.h"
+
+InputReader::InputReader(std::istream &input, int bufferSize) : input(input), buffer(bufferSize) {
+    this->dataBegin = 0;
+    this->dataEnd = 0;
+    this->isEndOfInput = false;
+}
+
+bool InputReader::AcceptNextLine(VertexCoverSolver &solver, std::function<std::string()> &solve) {
+    solve = nullptr;
+    while (true) {
+        char *data = this->buffer.data();
+        char *newline = (char*)std::memchr(data + this->dataBegin, '\n', this->dataEnd - this->dataBegin);
+        if (newline != nullptr) {
+            const char *lineBegin = data + this->dataBegin;
+            this->dataBegin = newline + 1 - data;
+            solve = solver.AcceptLineDeferred(lineBegin, newline);
+            return true;
+        }
+
+        if (this->isEndOfInput || (this->dataBegin == 0 && this->dataEnd == (int)this->buffer.size())) {
+            break;
+        }
+        this->fillBuffer();
+    }
+
+    if (this->dataBegin == this->dataEnd) {
+        // nothing after the last newline
+        return false;
+    }
+    if (this->isEndOfInput) {
+        // last line without newline
+        const char *lineBegin = this->buffer.data() + this->dataBegin;
+        this->dataBegin = this->dataEnd;
+        solve = solver.AcceptLineDeferred(lineBegin, this->buffer.data() + this->dataEnd);
+        return true;
+    }
+
+    solve = this->acceptLongLine(solver);
+    return true;
+}
+
+bool InputReader::HasBufferedLine() const {
+    return std::memchr(this->buffer.data() + this->dataBegin, '\n', this->dataEnd - this->dataBegin) != nullptr;
+}
+
+bool InputReader::fillBuffer() {
+    if (this->dataBegin > 0) {
+        std::memmove(this->buffer.data(), this->buffer.data() + this->dataBegin, this->dataEnd - this->dataBegin);
+        this->dataEnd -= this->dataBegin;
+        this->dataBegin = 0;
+    }
+
+    // only waits for the first character, the rest is what the stream has already, so lines arriving one by one are accepted at once
+    char *target = this->buffer.data() + this->dataEnd;
+    int capacity = this->buffer.size() - this->dataEnd;
+    int nRead = this->input.readsome(target, capacity);
+    if (nRead == 0) {
+        int c = this->input.get();
+        if (c != std::char_traits<char>::eof()) {
+            target[0] = c;
+            nRead = 1 + this->input.readsome(target + 1, capacity - 1);
+        }
+    }
+    this->dataEnd += nRead;
+    if (nRead == 0) {
+        this->isEndOfInput = true;
+    }
+    return nRead > 0;
+}
+
+std::function<std::string()> InputReader::acceptLongLine(VertexCoverSolver &solver) {
+    // only E lines are streamed, anything else is short once trimmed so it is kept as a whole
+    std::unique_ptr<EdgeLineStream> stream;
+    std::string line;
+    if (solver.IsExpectingEdges()) {
+        stream = solver.CreateEdgeLineStream();
+    }
+
+    while (true) {
+        char *data = this->buffer.data();
+        char *newline = (char*)std::memchr(data + this->dataBegin, '\n', this->dataEnd - this->dataBegin);
+        char *partEnd = newline != nullptr ? newline : data + this->dataEnd;
+        if (stream) {
+            stream->Append(data + this->dataBegin, partEnd);
+        } else {
+            line.append(data + this->dataBegin, partEnd);
+        }
+
+        if (newline != nullptr) {
+            this->dataBegin = newline + 1 - data;
+            break;
+        }
+        this->dataBegin = this->dataEnd;
+        if (!this->fillBuffer()) {
+            break;
+        }
+    }
+
+    if (stream) {
+        return solver.AcceptEdgeLineStreamDeferred(*stream);
+    }
+    return solver.AcceptLineDeferred(line);
+}
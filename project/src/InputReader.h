@@ -0,0 +1,54 @@
+#ifndef INPUT_READER_H
+#define INPUT_READER_H
+
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "VertexCoverSolver.h"
+
+/*
+Read command lines from an input stream through a buffer of fixed size
+Lines fitting in the buffer are parsed in place. A longer E command is passed to an EdgeLineStream part by part,
+so the text of an E line is never held in memory as a whole
+*/
+class InputReader {
+public:
+    explicit InputReader(std::istream &input, int bufferSize = 1 << 20);
+
+    /*
+    Pass the next line to solver, and set solve to what AcceptLineDeferred returns for it
+    Errors of the line are thrown after the whole line is read, so reading continues with the line after it
+    Return false if there are no more lines
+    */
+    bool AcceptNextLine(VertexCoverSolver &solver, std::function<std::string()> &solve);
+
+    /*
+    Return true if a whole line is already read into buffer, so accepting it does not wait for input
+    */
+    bool HasBufferedLine() const;
+
+private:
+    std::istream &input;
+
+    // Unread data is buffer[dataBegin, dataEnd)
+    std::vector<char> buffer;
+    int dataBegin;
+    int dataEnd;
+
+    bool isEndOfInput;
+
+    /*
+    Move unread data to the front of buffer and read more after it
+    Return false if nothing more is read
+    */
+    bool fillBuffer();
+
+    /*
+    Read the rest of a line longer than buffer, which begins with the unread data in buffer
+    */
+    std::function<std::string()> acceptLongLine(VertexCoverSolver &solver);
+};
+
+#endif
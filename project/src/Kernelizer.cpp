@@ -0,0 +1,335 @@
+#include <algorithm>
+#include <limits>
+
+#include "Kernelizer.h"
+
+Kernelizer::Kernelizer(const Graph &graph, int upperBound) {
+    this->nVertex = graph.GetVertexCount();
+
+    // without a known upper bound Buss rule never applies
+    this->budget = upperBound >= 0 ? upperBound : std::numeric_limits<int>::max();
+
+    this->adjVertices = std::vector<std::vector<int>>(nVertex + 1);
+    this->degree = std::vector<int>(nVertex + 1, 0);
+    this->isRemoved = std::vector<bool>(nVertex + 1, false);
+
+    auto selfLoopVertices = std::vector<int>();
+    for (int i = 1; i <= nVertex; i++) {
+        for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+            if (*neighbor == i) {
+                selfLoopVertices.push_back(i);
+            } else {
+                this->adjVertices[i].push_back(*neighbor);
+            }
+        }
+        this->degree[i] = this->adjVertices[i].size();
+    }
+
+    // a self loop can only be covered by its own vertex
+    for (unsigned i = 0; i < selfLoopVertices.size(); i++) {
+        this->takeVertex(selfLoopVertices[i]);
+    }
+
+    for (int i = nVertex; i >= 1; i--) {
+        this->pending.push_back(i);
+    }
+
+    while (true) {
+        this->applyDegreeRules();
+        if (this->applyHighDegreeRule()) {
+            continue;
+        }
+        if (this->applyCrownRule()) {
+            continue;
+        }
+        break;
+    }
+
+    // renumber remaining vertices
+    int nReduced = this->adjVertices.size();
+    auto kernelIndex = std::vector<int>(nReduced, 0);
+    this->kernelVertices = std::vector<int>(1, 0);
+    for (int i = 1; i < nReduced; i++) {
+        if (!this->isRemoved[i] && this->degree[i] > 0) {
+            kernelIndex[i] = this->kernelVertices.size();
+            this->kernelVertices.push_back(i);
+        }
+    }
+
+    auto edges = std::vector<std::pair<int, int>>();
+    for (unsigned i = 1; i < this->kernelVertices.size(); i++) {
+        const auto &neighbors = this->getNeighbors(this->kernelVertices[i]);
+        for (unsigned j = 0; j < neighbors.size(); j++) {
+            if (kernelIndex[neighbors[j]] > (int)i) {
+                edges.push_back(std::pair<int, int>(i, kernelIndex[neighbors[j]]));
+            }
+        }
+    }
+
+    this->kernel = std::unique_ptr<Graph>(new Graph(this->kernelVertices.size() - 1, edges));
+}
+
+Graph &Kernelizer::GetKernel() {
+    return *this->kernel;
+}
+
+std::vector<int> Kernelizer::LiftCover(const std::vector<int> &kernelCover) const {
+    auto isInCover = std::vector<bool>(this->adjVertices.size(), false);
+    for (unsigned i = 0; i < this->takenVertices.size(); i++) {
+        isInCover[this->takenVertices[i]] = true;
+    }
+    for (unsigned i = 0; i < kernelCover.size(); i++) {
+        isInCover[this->kernelVertices[kernelCover[i]]] = true;
+    }
+
+    // unfold in reverse order, as a later fold may contain vertices created by an earlier one
+    // if the merged vertex is in the cover both neighbors replace it, otherwise all its neighbors are covered and the folded vertex covers the rest
+    for (int i = this->folds.size() - 1; i >= 0; i--) {
+        const Fold &fold = this->folds[i];
+        if (isInCover[fold.merged]) {
+            isInCover[fold.neighbor_1] = true;
+            isInCover[fold.neighbor_2] = true;
+        } else {
+            isInCover[fold.vertex] = true;
+        }
+    }
+
+    auto result = std::vector<int>();
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (isInCover[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+const std::vector<int> &Kernelizer::getNeighbors(int vertex) {
+    auto &neighbors = this->adjVertices[vertex];
+    unsigned nAlive = 0;
+    for (unsigned i = 0; i < neighbors.size(); i++) {
+        if (!this->isRemoved[neighbors[i]]) {
+            neighbors[nAlive++] = neighbors[i];
+        }
+    }
+    neighbors.resize(nAlive);
+    return neighbors;
+}
+
+bool Kernelizer::isAdjacent(int vertex_1, int vertex_2) {
+    if (this->degree[vertex_1] > this->degree[vertex_2]) {
+        std::swap(vertex_1, vertex_2);
+    }
+    const auto &neighbors = this->getNeighbors(vertex_1);
+    return std::find(neighbors.begin(), neighbors.end(), vertex_2) != neighbors.end();
+}
+
+void Kernelizer::removeVertex(int vertex) {
+    this->isRemoved[vertex] = true;
+    this->degree[vertex] = 0;
+
+    const auto &neighbors = this->adjVertices[vertex];
+    for (unsigned i = 0; i < neighbors.size(); i++) {
+        if (!this->isRemoved[neighbors[i]]) {
+            this->degree[neighbors[i]]--;
+            this->pending.push_back(neighbors[i]);
+        }
+    }
+    std::vector<int>().swap(this->adjVertices[vertex]);
+}
+
+void Kernelizer::takeVertex(int vertex) {
+    this->takenVertices.push_back(vertex);
+    this->budget--;
+    this->removeVertex(vertex);
+}
+
+void Kernelizer::foldVertex(int vertex, int neighbor_1, int neighbor_2) {
+    int merged = this->adjVertices.size();
+    this->adjVertices.push_back(std::vector<int>());
+    this->degree.push_back(0);
+    this->isRemoved.push_back(false);
+
+    this->isRemoved[vertex] = true;
+    this->isRemoved[neighbor_1] = true;
+    this->isRemoved[neighbor_2] = true;
+    this->degree[vertex] = 0;
+    this->degree[neighbor_1] = 0;
+    this->degree[neighbor_2] = 0;
+
+    // neighbors of both vertices appear twice after sorting
+    auto neighbors = this->getNeighbors(neighbor_1);
+    const auto &neighbors_2 = this->getNeighbors(neighbor_2);
+    neighbors.insert(neighbors.end(), neighbors_2.begin(), neighbors_2.end());
+    std::sort(neighbors.begin(), neighbors.end());
+
+    auto &mergedNeighbors = this->adjVertices[merged];
+    for (unsigned i = 0; i < neighbors.size(); i++) {
+        int neighbor = neighbors[i];
+        if (i + 1 < neighbors.size() && neighbors[i + 1] == neighbor) {
+            // adjacent to both, two edges become one
+            this->degree[neighbor]--;
+            i++;
+        }
+        mergedNeighbors.push_back(neighbor);
+        this->adjVertices[neighbor].push_back(merged);
+        this->pending.push_back(neighbor);
+    }
+    this->degree[merged] = mergedNeighbors.size();
+    this->pending.push_back(merged);
+
+    std::vector<int>().swap(this->adjVertices[vertex]);
+    std::vector<int>().swap(this->adjVertices[neighbor_1]);
+    std::vector<int>().swap(this->adjVertices[neighbor_2]);
+
+    // the folded graph needs exactly one vertex less in its minimal cover
+    this->folds.push_back(Fold{vertex, neighbor_1, neighbor_2, merged});
+    this->budget--;
+}
+
+void Kernelizer::applyDegreeRules() {
+    while (!this->pending.empty()) {
+        int vertex = this->pending.back();
+        this->pending.pop_back();
+        if (this->isRemoved[vertex]) {
+            continue;
+        }
+
+        int vertexDegree = this->degree[vertex];
+        if (vertexDegree == 0) {
+            this->isRemoved[vertex] = true;
+        } else if (vertexDegree > this->budget) {
+            // not taking it would need all its neighbors, more than the bound
+            this->takeVertex(vertex);
+        } else if (vertexDegree == 1) {
+            // the neighbor covers this edge and possibly more
+            this->takeVertex(this->getNeighbors(vertex)[0]);
+        } else if (vertexDegree == 2) {
+            int neighbor_1 = this->getNeighbors(vertex)[0];
+            int neighbor_2 = this->getNeighbors(vertex)[1];
+            if (this->isAdjacent(neighbor_1, neighbor_2)) {
+                // a triangle needs two of its vertices, the neighbors cover the most
+                this->takeVertex(neighbor_1);
+                this->takeVertex(neighbor_2);
+            } else {
+                this->foldVertex(vertex, neighbor_1, neighbor_2);
+            }
+        }
+    }
+}
+
+bool Kernelizer::applyHighDegreeRule() {
+    bool hasTaken = false;
+    for (unsigned i = 1; i < this->adjVertices.size(); i++) {
+        if (!this->isRemoved[i] && this->degree[i] > this->budget) {
+            this->takeVertex(i);
+            hasTaken = true;
+        }
+    }
+    return hasTaken;
+}
+
+/*
+    Crown decomposition with https://doi.org/10.1007/978-3-540-30559-0_23
+*/
+bool Kernelizer::applyCrownRule() {
+    int nReduced = this->adjVertices.size();
+
+    // vertices outside a maximal matching are independent
+    auto isMatched = std::vector<bool>(nReduced, false);
+    for (int i = 1; i < nReduced; i++) {
+        if (this->isRemoved[i] || isMatched[i]) {
+            continue;
+        }
+        const auto &neighbors = this->getNeighbors(i);
+        for (unsigned j = 0; j < neighbors.size(); j++) {
+            if (!isMatched[neighbors[j]]) {
+                isMatched[i] = true;
+                isMatched[neighbors[j]] = true;
+                break;
+            }
+        }
+    }
+    auto outsiders = std::vector<int>();
+    for (int i = 1; i < nReduced; i++) {
+        if (!this->isRemoved[i] && !isMatched[i] && this->degree[i] > 0) {
+            outsiders.push_back(i);
+        }
+    }
+    if (outsiders.empty()) {
+        return false;
+    }
+
+    // maximum matching between outsiders and their neighbors with augmenting paths, 0 for unmatched
+    auto partner = std::vector<int>(nReduced, 0);
+    auto visitedRound = std::vector<int>(nReduced, 0);
+    auto reachedFrom = std::vector<int>(nReduced, 0);
+    auto queue = std::vector<int>();
+    for (unsigned i = 0; i < outsiders.size(); i++) {
+        int round = i + 1;
+        int freeNeighbor = 0;
+        queue.clear();
+        queue.push_back(outsiders[i]);
+        for (unsigned head = 0; head < queue.size() && freeNeighbor == 0; head++) {
+            const auto &neighbors = this->getNeighbors(queue[head]);
+            for (unsigned j = 0; j < neighbors.size(); j++) {
+                int neighbor = neighbors[j];
+                if (visitedRound[neighbor] == round) {
+                    continue;
+                }
+                visitedRound[neighbor] = round;
+                reachedFrom[neighbor] = queue[head];
+                if (partner[neighbor] == 0) {
+                    freeNeighbor = neighbor;
+                    break;
+                }
+                queue.push_back(partner[neighbor]);
+            }
+        }
+
+        // flip the matching along the path
+        while (freeNeighbor != 0) {
+            int outsider = reachedFrom[freeNeighbor];
+            int next = partner[outsider];
+            partner[outsider] = freeNeighbor;
+            partner[freeNeighbor] = outsider;
+            freeNeighbor = next;
+        }
+    }
+
+    // crown grows from unmatched outsiders through alternating paths, its head are the neighbors reached
+    auto isInCrown = std::vector<bool>(nReduced, false);
+    auto isInHead = std::vector<bool>(nReduced, false);
+    auto head = std::vector<int>();
+    queue.clear();
+    for (unsigned i = 0; i < outsiders.size(); i++) {
+        if (partner[outsiders[i]] == 0) {
+            isInCrown[outsiders[i]] = true;
+            queue.push_back(outsiders[i]);
+        }
+    }
+    if (queue.empty()) {
+        return false;
+    }
+    for (unsigned i = 0; i < queue.size(); i++) {
+        const auto &neighbors = this->getNeighbors(queue[i]);
+        for (unsigned j = 0; j < neighbors.size(); j++) {
+            int neighbor = neighbors[j];
+            if (isInHead[neighbor]) {
+                continue;
+            }
+            isInHead[neighbor] = true;
+            head.push_back(neighbor);
+            // every head vertex is matched, otherwise the matching would not be maximum
+            if (partner[neighbor] != 0 && !isInCrown[partner[neighbor]]) {
+                isInCrown[partner[neighbor]] = true;
+                queue.push_back(partner[neighbor]);
+            }
+        }
+    }
+
+    // crown vertices become isolated and are removed by degree rules
+    for (unsigned i = 0; i < head.size(); i++) {
+        this->takeVertex(head[i]);
+    }
+    return true;
+}
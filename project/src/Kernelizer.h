@@ -0,0 +1,98 @@
+#ifndef KERNELIZER_H
+#define KERNELIZER_H
+
+#include <memory>
+#include <vector>
+
+#include "Graph.h"
+
+/*
+Reduce a graph to a smaller kernel with the same minimal vertex cover size up to a known offset.
+Rules are applied until none of them changes the graph:
+    a vertex with a self loop is taken into the cover
+    a vertex of degree 0 is removed
+    a vertex of degree 1 is removed with its neighbor taken into the cover
+    a vertex of degree 2 is removed with both neighbors taken if they are adjacent, or folded with them into one vertex otherwise
+    a vertex of degree larger than the remaining upper bound is taken into the cover (Buss rule)
+    a crown found from a maximal matching has its head taken into the cover (Chor-Fellows-Juedes)
+*/
+class Kernelizer {
+public:
+    /*
+    Reduce graph
+    upperBound is size of any vertex cover of the graph, used by Buss rule. Buss rule is skipped if it is negative
+    */
+    Kernelizer(const Graph &graph, int upperBound);
+
+    /*
+    Return the kernel, vertices are renumbered to [1, vertex count of kernel]
+    */
+    Graph &GetKernel();
+
+    /*
+    Return a vertex cover of the original graph in ascending order, from a vertex cover of the kernel
+    The result is minimal if kernelCover is minimal
+    */
+    std::vector<int> LiftCover(const std::vector<int> &kernelCover) const;
+
+private:
+    // A degree 2 vertex folded with its two non-adjacent neighbors into a new vertex
+    struct Fold {
+        int vertex;
+        int neighbor_1;
+        int neighbor_2;
+        int merged;
+    };
+
+    // Vertex count of the original graph, vertices created by folding are numbered after it
+    int nVertex;
+
+    // Remaining upper bound of cover size of the reduced graph, negative if unknown
+    int budget;
+
+    // Neighbor lists of the reduced graph, may contain removed vertices which are skipped and dropped lazily
+    std::vector<std::vector<int>> adjVertices;
+
+    // Count of neighbors not removed yet
+    std::vector<int> degree;
+
+    std::vector<bool> isRemoved;
+
+    // Vertices to check against degree rules
+    std::vector<int> pending;
+
+    // Vertices taken into the cover, including vertices created by folding
+    std::vector<int> takenVertices;
+
+    std::vector<Fold> folds;
+
+    // Vertex of the reduced graph for each kernel vertex. The first element is ignored
+    std::vector<int> kernelVertices;
+
+    std::unique_ptr<Graph> kernel;
+
+    // Drop removed vertices from the neighbor list of vertex and return it
+    const std::vector<int> &getNeighbors(int vertex);
+
+    bool isAdjacent(int vertex_1, int vertex_2);
+
+    // Remove vertex with its edges and recheck its neighbors
+    void removeVertex(int vertex);
+
+    // Take vertex into the cover and remove it
+    void takeVertex(int vertex);
+
+    // Replace vertex and its two non-adjacent neighbors with a new vertex adjacent to all neighbors of the two neighbors
+    void foldVertex(int vertex, int neighbor_1, int neighbor_2);
+
+    // Apply rules on pending vertices until there is none
+    void applyDegreeRules();
+
+    // Return true if any vertex is taken by Buss rule
+    bool applyHighDegreeRule();
+
+    // Return true if a crown is found and removed
+    bool applyCrownRule();
+};
+
+#endif
@@ -0,0 +1,101 @@
+#include <cstring>
+
+#include "OutputBuffer.h"
+
+// Two characters of every number in [0, 100)
+const char digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Write digits of value ending right before end, return the position of the first digit
+char *formatUnsigned(unsigned value, char *end) {
+    char *c = end;
+    while (value >= 100) {
+        unsigned pair = value % 100;
+        value /= 100;
+        c -= 2;
+        std::memcpy(c, digitPairs + pair * 2, 2);
+    }
+    if (value >= 10) {
+        c -= 2;
+        std::memcpy(c, digitPairs + value * 2, 2);
+    } else {
+        *--c = '0' + value;
+    }
+    return c;
+}
+
+void OutputBuffer::Append(char c) {
+    this->text.push_back(c);
+}
+
+void OutputBuffer::Append(const char *text) {
+    this->text.append(text);
+}
+
+void OutputBuffer::Append(const std::string &text) {
+    this->text.append(text);
+}
+
+void OutputBuffer::AppendInt(int value) {
+    // sign and 10 digits of any int
+    char digits[11];
+    char *end = digits + sizeof(digits);
+    // negated as unsigned, so INT_MIN does not overflow
+    char *begin = formatUnsigned(value < 0 ? 0u - (unsigned)value : (unsigned)value, end);
+    if (value < 0) {
+        *--begin = '-';
+    }
+    this->text.append(begin, end);
+}
+
+void OutputBuffer::AppendList(const std::vector<int> &values) {
+    if (values.empty()) {
+        return;
+    }
+
+    this->text.reserve(this->text.size() + OutputBuffer::GetListLength(values));
+    this->AppendInt(values[0]);
+    for (unsigned i = 1; i < values.size(); i++) {
+        this->text.push_back(',');
+        this->AppendInt(values[i]);
+    }
+}
+
+size_t OutputBuffer::GetListLength(const std::vector<int> &values) {
+    if (values.empty()) {
+        return 0;
+    }
+
+    // covers are in ascending order, so the last value has the most digits and bounds the length of every value
+    char digits[11];
+    char *end = digits + sizeof(digits);
+    size_t maxLength = end - formatUnsigned(values.back() < 0 ? 0 : values.back(), end) + 1;
+    return values.size() * maxLength;
+}
+
+void OutputBuffer::Reserve(size_t length) {
+    this->text.reserve(length);
+}
+
+const std::string &OutputBuffer::GetText() const {
+    return this->text;
+}
+
+std::string OutputBuffer::TakeText() {
+    std::string result;
+    result.swap(this->text);
+    return result;
+}
+
+void OutputBuffer::Clear() {
+    this->text.clear();
+}
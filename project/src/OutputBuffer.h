@@ -0,0 +1,52 @@
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+
+#include <string>
+#include <vector>
+
+/*
+Text of an output built without streams, with integers formatted two digits at a time
+Reserve the length of the whole output first, so the text is allocated once, and take it with TakeText instead of copying it
+*/
+class OutputBuffer {
+public:
+    void Append(char c);
+
+    void Append(const char *text);
+
+    void Append(const std::string &text);
+
+    /*
+    Append decimal digits of value, with '-' in front if it is negative
+    */
+    void AppendInt(int value);
+
+    /*
+    Append values separated by ','
+    */
+    void AppendList(const std::vector<int> &values);
+
+    /*
+    Return length of values appended by AppendList at most
+    */
+    static size_t GetListLength(const std::vector<int> &values);
+
+    /*
+    Allocate text for length characters in total
+    */
+    void Reserve(size_t length);
+
+    const std::string &GetText() const;
+
+    /*
+    Return text, moved out of this buffer, which is empty afterwards
+    */
+    std::string TakeText();
+
+    void Clear();
+
+private:
+    std::string text;
+};
+
+#endif
@@ -1,123 +1,262 @@
+#include <algorithm>
+#include <climits>
 #include <stdexcept>
 
+#include "EdgeScanner.h"
 #include "Parser.h"
 
-int Parser::GetVertexCount(std::string line) {
-    if (line.size() < 2 || line[0] != 'V' || line[1] != ' ') {
-        throw std::invalid_argument("wrong format when parsing vertex count");
+const char *vertexIndexErrorMessage = "not able to convert vertex index to int when parsing edges";
+
+void checkVertexIndex(int vertexIndex, int nVertex) {
+    if (vertexIndex <= 0) {
+        throw std::invalid_argument("vertex index should be greater than 0");
     }
 
-    std::string countRaw = line.substr(2);
-    int count = getIntFromString(countRaw, "not able to covert vertex count to int when parsing vertex count");
-    if (count < 2) {
-        throw std::invalid_argument("there should be at least 2 vertices");
+    if (vertexIndex > nVertex) {
+        throw std::invalid_argument("vertex index exceeds the maximum allowed value");
     }
+}
 
-    return count;
+IntAccumulator::IntAccumulator() {
+    this->value = 0;
+    this->nDigit = 0;
+    this->isValid = true;
 }
 
-std::vector<std::pair<int, int>> Parser::GetEdges(std::string line, int nVertex) {
-    auto lineSize = line.size();
-    if (lineSize < 4 || line[0] != 'E' || line[1] != ' ' || line[2] != '{' || line[lineSize - 1] != '}') {
-        throw std::invalid_argument("wrong format when parsing edges");
+void IntAccumulator::Push(char c) {
+    if (c < '0' || c > '9' || (this->nDigit == 1 && this->value == 0)) {
+        // not a digit, or a zero in front of other digits
+        this->isValid = false;
     }
+    else if (this->isValid) {
+        int digit = c - '0';
+        if (this->value > (INT_MAX - digit) / 10) {
+            this->isValid = false;
+        } else {
+            this->value = this->value * 10 + digit;
+        }
+    }
+    this->nDigit++;
+}
 
-    auto result = std::vector<std::pair<int, int>>();
+bool IntAccumulator::IsValidInt() const {
+    return this->isValid && this->nDigit > 0;
+}
 
-    std::string edgesRaw = line.substr(3, lineSize - 4);
-    auto edgesRawSize = edgesRaw.size();
+int IntAccumulator::GetValue() const {
+    return this->value;
+}
 
-    if (edgesRawSize == 0) {
-        return result;
-    }
+EdgeListReader::EdgeListReader(int nVertex, std::vector<std::pair<int, int>> &result) : result(result) {
+    this->nVertex = nVertex;
+    this->state = 0;
+    this->firstNumber = 0;
+}
 
-    int state = 0;
-    int numberStartIndex = 0;
-    int firstNumber = 0;
-    unsigned i = 0;
-    while (i < edgesRawSize) {
-        if (state == 0) {
+void EdgeListReader::Read(const char *begin, const char *end) {
+    for (const char *c = begin; c != end; c++) {
+        if (this->state == 0) {
             // accepting '<', ending with '<'
-            if (edgesRaw[i] != '<') {
+            if (*c != '<') {
                 throw std::invalid_argument("expecting '<' when parsing edges");
             }
-            numberStartIndex = i + 1;
-            state = 1;
+            this->number = IntAccumulator();
+            this->state = 1;
         }
-        else if (state == 1) {
+        else if (this->state == 1) {
             // accepting first vertex number, ending with ','
-            if (edgesRaw[i] == ',') {
-                std::string numberRaw = edgesRaw.substr(numberStartIndex, i - numberStartIndex);
-                firstNumber = getIntFromString(numberRaw, "not able to convert vertex index to int when parsing edges");
-                checkVertexIndex(firstNumber, nVertex);
-                numberStartIndex = i + 1;
-                state = 2;
+            if (*c == ',') {
+                if (!this->number.IsValidInt()) {
+                    throw std::invalid_argument(vertexIndexErrorMessage);
+                }
+                this->firstNumber = this->number.GetValue();
+                checkVertexIndex(this->firstNumber, this->nVertex);
+                this->number = IntAccumulator();
+                this->state = 2;
+            } else {
+                this->number.Push(*c);
             }
         }
-        else if (state == 2) {
+        else if (this->state == 2) {
             // accepting second vertex number, ending with '>'
-            if (edgesRaw[i] == '>') {
-                std::string numberRaw = edgesRaw.substr(numberStartIndex, i - numberStartIndex);
-                int secondNumber = getIntFromString(numberRaw, "not able to convert vertex index to int when parsing edges");
-                checkVertexIndex(secondNumber, nVertex);
-                result.push_back(std::pair<int, int>(firstNumber, secondNumber));
-                state = 3;
+            if (*c == '>') {
+                if (!this->number.IsValidInt()) {
+                    throw std::invalid_argument(vertexIndexErrorMessage);
+                }
+                checkVertexIndex(this->number.GetValue(), this->nVertex);
+                this->result.push_back(std::pair<int, int>(this->firstNumber, this->number.GetValue()));
+                this->state = 3;
+            } else {
+                this->number.Push(*c);
             }
         }
-        else if (state == 3) {
+        else if (this->state == 3) {
             // accepting ',', ending with ','
-            if (edgesRaw[i] != ',') {
+            if (*c != ',') {
                 throw std::invalid_argument("expecting ',' when parsing edges");
             }
-            state = 0;
+            this->state = 0;
+        }
+    }
+}
+
+void EdgeListReader::Finish() {
+    if (this->state != 3) {
+        throw std::invalid_argument("wrong format when parsing edges");
+    }
+}
+
+EdgeLineStream::EdgeLineStream(int nVertex) : reader(nVertex, edges) {
+    this->headerLength = 0;
+    this->isHeaderValid = true;
+    this->hasPendingBrace = false;
+    this->hasPendingSpaces = false;
+    this->hasEdgeCharacters = false;
+}
+
+void EdgeLineStream::Append(const char *begin, const char *end) {
+    const char *header = "E {";
+    const char *c = begin;
+    while (c != end) {
+        if (this->headerLength < 3) {
+            // leading spaces are trimmed, the header is matched as is
+            if (this->headerLength > 0 || *c != ' ') {
+                this->isHeaderValid = this->isHeaderValid && *c == header[this->headerLength];
+                this->headerLength++;
+            }
+            c++;
+            continue;
+        }
+        if (!this->isHeaderValid) {
+            // wrong format whatever follows
+            return;
+        }
+
+        if (*c == ' ') {
+            this->hasPendingSpaces = true;
+            c++;
+            continue;
+        }
+
+        // the pending characters are inside the line after all
+        // a single space puts the reader in the same state as several, since it either throws or invalidates the number being read
+        if (this->hasPendingBrace) {
+            this->readEdgeCharacters("}", "}" + 1);
+            this->hasPendingBrace = false;
+        }
+        if (this->hasPendingSpaces) {
+            this->readEdgeCharacters(" ", " " + 1);
+            this->hasPendingSpaces = false;
+        }
+
+        if (*c == '}') {
+            this->hasPendingBrace = true;
+            c++;
+            continue;
         }
 
-        i++;
+        const char *runEnd = c;
+        while (runEnd != end && *runEnd != ' ' && *runEnd != '}') {
+            runEnd++;
+        }
+        this->readEdgeCharacters(c, runEnd);
+        c = runEnd;
     }
+}
 
-    if (state != 3) {
+bool EdgeLineStream::IsBlank() const {
+    return this->headerLength == 0;
+}
+
+std::vector<std::pair<int, int>> EdgeLineStream::Finish() {
+    // same order of checks as Parser::GetEdges, the format of the whole line comes first
+    if (this->headerLength < 3 || !this->isHeaderValid || !this->hasPendingBrace) {
         throw std::invalid_argument("wrong format when parsing edges");
     }
+    if (this->error) {
+        std::rethrow_exception(this->error);
+    }
+    if (this->hasEdgeCharacters) {
+        this->reader.Finish();
+    }
 
+    auto result = std::vector<std::pair<int, int>>();
+    result.swap(this->edges);
     return result;
 }
 
-int Parser::getIntFromString(std::string intStr, std::string errorMessage) {
-    if (intStr.size() == 0) {
-        throw std::invalid_argument(errorMessage);
+void EdgeLineStream::readEdgeCharacters(const char *begin, const char *end) {
+    if (this->error) {
+        return;
+    }
+    this->hasEdgeCharacters = true;
+    try {
+        this->reader.Read(begin, end);
     }
+    catch (std::invalid_argument &) {
+        this->error = std::current_exception();
+    }
+}
 
-    if (intStr.size() == 1) {
-        if (!std::isdigit(intStr[0])) {
-            throw std::invalid_argument(errorMessage);
-        }
-        return intStr[0] - '0';
+int Parser::GetVertexCount(const std::string &line) {
+    return this->GetVertexCount(line.data(), line.data() + line.size());
+}
+
+int Parser::GetVertexCount(const char *begin, const char *end) {
+    if (end - begin < 2 || begin[0] != 'V' || begin[1] != ' ') {
+        throw std::invalid_argument("wrong format when parsing vertex count");
     }
 
-    if (intStr[0] == '0') {
-        throw std::invalid_argument(errorMessage);
+    int count = getIntFromRange(begin + 2, end, "not able to covert vertex count to int when parsing vertex count");
+    if (count < 2) {
+        throw std::invalid_argument("there should be at least 2 vertices");
     }
 
-    for (unsigned i = 0; i < intStr.size(); i++) {
-        if (!std::isdigit(intStr[i])) {
-            throw std::invalid_argument(errorMessage);
-        }
+    return count;
+}
+
+std::vector<std::pair<int, int>> Parser::GetEdges(const std::string &line, int nVertex) {
+    return this->GetEdges(line.data(), line.data() + line.size(), nVertex);
+}
+
+std::vector<std::pair<int, int>> Parser::GetEdges(const char *begin, const char *end, int nVertex) {
+    auto lineSize = end - begin;
+    if (lineSize < 4 || begin[0] != 'E' || begin[1] != ' ' || begin[2] != '{' || end[-1] != '}') {
+        throw std::invalid_argument("wrong format when parsing edges");
     }
 
-    try {
-        return std::stoi(intStr);
+    auto result = std::vector<std::pair<int, int>>();
+
+    const char *edgesBegin = begin + 3;
+    const char *edgesEnd = end - 1;
+    if (edgesBegin == edgesEnd) {
+        return result;
     }
-    catch (...) {
-        throw std::invalid_argument(errorMessage);
+
+    // every edge ends with '>', so this is the edge count of a valid line
+    result.reserve(std::count(edgesBegin, edgesEnd, '>'));
+
+    // vector scanning accepts well-formed edges only, anything else is read again below to find the error
+    if (ScanEdges(GetSupportedSimdLevel(), edgesBegin, edgesEnd, nVertex, result)) {
+        return result;
     }
+    result.clear();
+
+    EdgeListReader reader(nVertex, result);
+    reader.Read(edgesBegin, edgesEnd);
+    reader.Finish();
+
+    return result;
 }
 
-void Parser::checkVertexIndex(int vertexIndex, int nVertex) {
-    if (vertexIndex <= 0) {
-        throw std::invalid_argument("vertex index should be greater than 0");
+int Parser::getIntFromRange(const char *begin, const char *end, const char *errorMessage) {
+    IntAccumulator number;
+    for (const char *c = begin; c != end; c++) {
+        number.Push(*c);
     }
 
-    if (vertexIndex > nVertex) {
-        throw std::invalid_argument("vertex index exceeds the maximum allowed value");
+    if (!number.IsValidInt()) {
+        throw std::invalid_argument(errorMessage);
     }
+    return number.GetValue();
 }
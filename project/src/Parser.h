@@ -1,9 +1,112 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <exception>
 #include <string>
 #include <vector>
 
+/*
+Digits of an int read one character at a time
+It becomes invalid on anything but digits without a zero in front, or when the value exceeds int
+*/
+class IntAccumulator {
+public:
+    IntAccumulator();
+
+    void Push(char c);
+
+    bool IsValidInt() const;
+
+    int GetValue() const;
+
+private:
+    int value;
+    int nDigit;
+    bool isValid;
+};
+
+/*
+Character state machine reading edges "<[i],[i]>(,<[i],[i]>)*", which may be split into parts at any character
+*/
+class EdgeListReader {
+public:
+    /*
+    Append edges read to result
+    */
+    EdgeListReader(int nVertex, std::vector<std::pair<int, int>> &result);
+
+    /*
+    Read characters in range [begin, end)
+    Throws on the first character making the edges invalid, with the same messages as Parser::GetEdges
+    */
+    void Read(const char *begin, const char *end);
+
+    /*
+    Throws if the characters read so far do not end with a complete edge
+    */
+    void Finish();
+
+private:
+    int nVertex;
+
+    std::vector<std::pair<int, int>> &result;
+
+    // 0: expecting '<', 1: reading first vertex, 2: reading second vertex, 3: expecting ','
+    int state;
+
+    int firstNumber;
+
+    IntAccumulator number;
+};
+
+/*
+E command line read in parts, for lines too long to hold in memory at once
+Spaces around the line and the closing '}' are only known at the end of line, so errors are deferred to Finish,
+which throws what Parser::GetEdges would throw for the whole line
+*/
+class EdgeLineStream {
+public:
+    explicit EdgeLineStream(int nVertex);
+
+    /*
+    Read the next part of the line
+    */
+    void Append(const char *begin, const char *end);
+
+    /*
+    Return true if only spaces are read so far
+    */
+    bool IsBlank() const;
+
+    /*
+    Return edges of the whole line, or throw its error
+    */
+    std::vector<std::pair<int, int>> Finish();
+
+private:
+    std::vector<std::pair<int, int>> edges;
+
+    EdgeListReader reader;
+
+    // Count of characters of "E {" read after leading spaces, and whether they match
+    int headerLength;
+    bool isHeaderValid;
+
+    // Indicates whether the last character other than space is '}', which is not passed to reader unless more follows
+    bool hasPendingBrace;
+
+    // Indicates whether there are spaces after the last character other than space, not passed to reader unless more follows
+    bool hasPendingSpaces;
+
+    // Indicates whether any character is passed to reader
+    bool hasEdgeCharacters;
+
+    // First error thrown by reader
+    std::exception_ptr error;
+
+    void readEdgeCharacters(const char *begin, const char *end);
+};
+
 class Parser {
 public:
     /*
@@ -13,7 +116,12 @@ public:
         i is not valid int
         i is not greater than 1
     */
-    int GetVertexCount(std::string line);
+    int GetVertexCount(const std::string &line);
+
+    /*
+    Same as above, with the command line in range [begin, end)
+    */
+    int GetVertexCount(const char *begin, const char *end);
 
     /*
     Get edges from the command line
@@ -22,11 +130,16 @@ public:
         i is not valid int
         i is not in range [1, nVertex]
     */
-    std::vector<std::pair<int, int>> GetEdges(std::string line, int nVertex);
+    std::vector<std::pair<int, int>> GetEdges(const std::string &line, int nVertex);
+
+    /*
+    Same as above, with the command line in range [begin, end)
+    The range is read once without copying, and vertex indices are accumulated while reading
+    */
+    std::vector<std::pair<int, int>> GetEdges(const char *begin, const char *end, int nVertex);
 
 private:
-    int getIntFromString(std::string intStr, std::string errorMessage);
-    void checkVertexIndex(int vertexIndex, int nVertex);
+    int getIntFromRange(const char *begin, const char *end, const char *errorMessage);
 };
 
 #endif
@@ -0,0 +1,115 @@
+#include <algorithm>
+
+#include "ResultCache.h"
+
+uint64_t rotateLeft(uint64_t value, int shift) {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+// MurmurHash3 finalizer, so every input bit affects every output bit
+uint64_t mixBits(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+// Two lanes of different constants, each absorbing every word in order
+class FingerprintHasher {
+public:
+    FingerprintHasher() {
+        this->hash_1 = 0x9e3779b97f4a7c15ULL;
+        this->hash_2 = 0x6a09e667f3bcc909ULL;
+    }
+
+    void Push(uint32_t word) {
+        this->hash_1 = rotateLeft(this->hash_1 ^ (word * 0x87c37b91114253d5ULL), 31) * 0x4cf5ad432745937fULL + 0x52dce729;
+        this->hash_2 = rotateLeft(this->hash_2 ^ (word * 0x4cf5ad432745937fULL), 33) * 0x87c37b91114253d5ULL + 0x38495ab5;
+    }
+
+    void Finish(uint64_t &hash_1, uint64_t &hash_2) const {
+        hash_1 = mixBits(this->hash_1 + this->hash_2);
+        hash_2 = mixBits(this->hash_2 + hash_1);
+    }
+
+private:
+    uint64_t hash_1;
+    uint64_t hash_2;
+};
+
+bool GraphFingerprint::operator==(const GraphFingerprint &other) const {
+    return this->hash_1 == other.hash_1 && this->hash_2 == other.hash_2
+        && this->nVertex == other.nVertex && this->nNeighbors == other.nNeighbors;
+}
+
+size_t GraphFingerprintHash::operator()(const GraphFingerprint &fingerprint) const {
+    return fingerprint.hash_1;
+}
+
+GraphFingerprint GetGraphFingerprint(const Graph &graph) {
+    GraphFingerprint fingerprint;
+    fingerprint.nVertex = graph.GetVertexCount();
+    fingerprint.nNeighbors = 0;
+
+    // degree in front of every row, so rows cannot shift into each other
+    FingerprintHasher hasher;
+    for (int i = 1; i <= fingerprint.nVertex; i++) {
+        const int *begin = graph.GetNeighborsBegin(i);
+        const int *end = graph.GetNeighborsEnd(i);
+        hasher.Push(end - begin);
+        for (const int *neighbor = begin; neighbor != end; neighbor++) {
+            hasher.Push(*neighbor);
+        }
+        fingerprint.nNeighbors += end - begin;
+    }
+    hasher.Finish(fingerprint.hash_1, fingerprint.hash_2);
+    return fingerprint;
+}
+
+ResultCache::ResultCache(int capacity) {
+    this->capacity = std::max(1, capacity);
+    pthread_mutex_init(&this->mutex, nullptr);
+}
+
+ResultCache::~ResultCache() {
+    pthread_mutex_destroy(&this->mutex);
+}
+
+bool ResultCache::Find(const GraphFingerprint &fingerprint, CachedCovers &covers) {
+    pthread_mutex_lock(&this->mutex);
+    auto entry = this->entryOfFingerprint.find(fingerprint);
+    bool isFound = entry != this->entryOfFingerprint.end();
+    if (isFound) {
+        this->entries.splice(this->entries.begin(), this->entries, entry->second);
+        covers = entry->second->second;
+    }
+    pthread_mutex_unlock(&this->mutex);
+    return isFound;
+}
+
+void ResultCache::Insert(const GraphFingerprint &fingerprint, const CachedCovers &covers) {
+    pthread_mutex_lock(&this->mutex);
+    auto entry = this->entryOfFingerprint.find(fingerprint);
+    if (entry != this->entryOfFingerprint.end()) {
+        // solved again by another thread before either stored it
+        this->entries.splice(this->entries.begin(), this->entries, entry->second);
+        entry->second->second = covers;
+    } else {
+        if ((int)this->entries.size() == this->capacity) {
+            this->entryOfFingerprint.erase(this->entries.back().first);
+            this->entries.pop_back();
+        }
+        this->entries.push_front(std::make_pair(fingerprint, covers));
+        this->entryOfFingerprint[fingerprint] = this->entries.begin();
+    }
+    pthread_mutex_unlock(&this->mutex);
+}
+
+int ResultCache::GetSize() const {
+    pthread_mutex_lock(&this->mutex);
+    int size = this->entries.size();
+    pthread_mutex_unlock(&this->mutex);
+    return size;
+}
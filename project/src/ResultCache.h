@@ -0,0 +1,82 @@
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <pthread.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Graph.h"
+
+/*
+128-bit hash of the adjacency arrays of a graph, which are deduplicated and sorted when the graph is built
+Graphs of the same edge set have the same fingerprint, whatever the order and repetition of their edges in input
+Vertex and neighbor counts are kept beside the hash, so graphs of different sizes never match
+*/
+struct GraphFingerprint {
+    uint64_t hash_1;
+    uint64_t hash_2;
+    int nVertex;
+    int nNeighbors;
+
+    bool operator==(const GraphFingerprint &other) const;
+};
+
+struct GraphFingerprintHash {
+    size_t operator()(const GraphFingerprint &fingerprint) const;
+};
+
+/*
+Return fingerprint of graph
+*/
+GraphFingerprint GetGraphFingerprint(const Graph &graph);
+
+/*
+Covers found by every method for a graph
+*/
+struct CachedCovers {
+    // Minimal cover of the exact method
+    std::vector<int> exact;
+    std::vector<int> approx_1;
+    std::vector<int> approx_2;
+};
+
+/*
+Least recently used covers of graphs by fingerprint, safe to use from several threads
+*/
+class ResultCache {
+public:
+    /*
+    Keep covers of at most capacity graphs
+    */
+    explicit ResultCache(int capacity);
+    ~ResultCache();
+
+    /*
+    Set covers to those of fingerprint and mark them as used most recently
+    Return false if they are not in the cache
+    */
+    bool Find(const GraphFingerprint &fingerprint, CachedCovers &covers);
+
+    /*
+    Store covers of fingerprint, replacing the least recently used covers if the cache is full
+    */
+    void Insert(const GraphFingerprint &fingerprint, const CachedCovers &covers);
+
+    int GetSize() const;
+
+private:
+    int capacity;
+
+    // Most recently used first
+    std::list<std::pair<GraphFingerprint, CachedCovers>> entries;
+
+    std::unordered_map<GraphFingerprint, std::list<std::pair<GraphFingerprint, CachedCovers>>::iterator, GraphFingerprintHash> entryOfFingerprint;
+
+    // Guards entries and entryOfFingerprint
+    mutable pthread_mutex_t mutex;
+};
+
+#endif
@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(int nThread) {
+    this->isStopping = false;
+    pthread_mutex_init(&this->mutex, nullptr);
+    pthread_cond_init(&this->condition, nullptr);
+
+    nThread = std::max(1, nThread);
+    for (int i = 0; i < nThread; i++) {
+        pthread_t thread;
+        if (pthread_create(&thread, nullptr, ThreadPool::workerMain, this) != 0) {
+            throw std::runtime_error("error starting thread pool worker");
+        }
+        this->threads.push_back(thread);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    pthread_mutex_lock(&this->mutex);
+    this->isStopping = true;
+    pthread_cond_broadcast(&this->condition);
+    pthread_mutex_unlock(&this->mutex);
+
+    for (unsigned i = 0; i < this->threads.size(); i++) {
+        pthread_join(this->threads[i], nullptr);
+    }
+
+    pthread_cond_destroy(&this->condition);
+    pthread_mutex_destroy(&this->mutex);
+}
+
+int ThreadPool::GetThreadCount() const {
+    return this->threads.size();
+}
+
+ThreadPool &ThreadPool::Shared() {
+    static ThreadPool pool(std::thread::hardware_concurrency());
+    return pool;
+}
+
+void ThreadPool::enqueue(const std::function<void()> &task) {
+    pthread_mutex_lock(&this->mutex);
+    this->tasks.push_back(task);
+    pthread_cond_signal(&this->condition);
+    pthread_mutex_unlock(&this->mutex);
+}
+
+std::future<void> ThreadPool::Submit(const std::function<void()> &task) {
+    // std::function needs a copyable target, so the packaged task is shared
+    auto packagedTask = std::make_shared<std::packaged_task<void()>>(task);
+    auto future = packagedTask->get_future();
+    this->enqueue([packagedTask]() {
+        (*packagedTask)();
+    });
+    return future;
+}
+
+void *ThreadPool::workerMain(void *data) {
+    ThreadPool *pool = (ThreadPool*)data;
+
+    while (true) {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->tasks.empty() && !pool->isStopping) {
+            pthread_cond_wait(&pool->condition, &pool->mutex);
+        }
+        if (pool->tasks.empty()) {
+            // stopping with nothing left to run
+            pthread_mutex_unlock(&pool->mutex);
+            return nullptr;
+        }
+        auto task = pool->tasks.front();
+        pool->tasks.pop_front();
+        pthread_mutex_unlock(&pool->mutex);
+
+        task();
+    }
+}
+
+void ThreadPool::ParallelFor(int count, const std::function<void(int)> &body) {
+    if (count <= 0) {
+        return;
+    }
+    if (count == 1) {
+        body(0);
+        return;
+    }
+
+    // Shared by the caller and helper tasks, helpers may start after all indices are taken and only touch the counters then
+    struct ParallelForState {
+        std::atomic<int> nextIndex;
+        int count;
+        int nFinished;
+        const std::function<void(int)> *body;
+        std::exception_ptr exception;
+        pthread_mutex_t mutex;
+        pthread_cond_t condition;
+
+        ~ParallelForState() {
+            pthread_cond_destroy(&condition);
+            pthread_mutex_destroy(&mutex);
+        }
+    };
+    auto state = std::make_shared<ParallelForState>();
+    state->nextIndex = 0;
+    state->count = count;
+    state->nFinished = 0;
+    state->body = &body;
+    pthread_mutex_init(&state->mutex, nullptr);
+    pthread_cond_init(&state->condition, nullptr);
+
+    auto runIndices = [state]() {
+        while (true) {
+            int index = state->nextIndex++;
+            if (index >= state->count) {
+                return;
+            }
+
+            std::exception_ptr exception;
+            try {
+                (*state->body)(index);
+            }
+            catch (...) {
+                exception = std::current_exception();
+            }
+
+            pthread_mutex_lock(&state->mutex);
+            if (exception && !state->exception) {
+                state->exception = exception;
+            }
+            state->nFinished++;
+            if (state->nFinished == state->count) {
+                pthread_cond_signal(&state->condition);
+            }
+            pthread_mutex_unlock(&state->mutex);
+        }
+    };
+
+    int nHelper = std::min(count - 1, this->GetThreadCount());
+    for (int i = 0; i < nHelper; i++) {
+        this->enqueue(runIndices);
+    }
+    runIndices();
+
+    pthread_mutex_lock(&state->mutex);
+    while (state->nFinished < state->count) {
+        pthread_cond_wait(&state->condition, &state->mutex);
+    }
+    std::exception_ptr exception = state->exception;
+    pthread_mutex_unlock(&state->mutex);
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <pthread.h>
+#include <vector>
+
+/*
+Fixed set of worker threads running queued tasks
+*/
+class ThreadPool {
+public:
+    /*
+    Start nThread workers, at least one
+    */
+    explicit ThreadPool(int nThread);
+
+    /*
+    Finish queued tasks and join all workers
+    */
+    ~ThreadPool();
+
+    /*
+    Run body(i) for every i in [0, count), and return after all of them finish
+    The calling thread takes indices as well, so it is safe to call from a task of the same pool
+    The first exception thrown by body is rethrown after all indices finish
+    */
+    void ParallelFor(int count, const std::function<void(int)> &body);
+
+    /*
+    Queue task to run on a worker, the future is ready when it finishes and holds the exception it throws if any
+    */
+    std::future<void> Submit(const std::function<void()> &task);
+
+    int GetThreadCount() const;
+
+    /*
+    Pool shared by the whole process, with one worker per hardware thread
+    */
+    static ThreadPool &Shared();
+
+private:
+    std::vector<pthread_t> threads;
+
+    // Tasks waiting for a worker, guarded by mutex
+    std::deque<std::function<void()>> tasks;
+
+    pthread_mutex_t mutex;
+
+    // Signaled when a task is queued or the pool is stopping
+    pthread_cond_t condition;
+
+    bool isStopping;
+
+    void enqueue(const std::function<void()> &task);
+
+    static void *workerMain(void *data);
+};
+
+#endif
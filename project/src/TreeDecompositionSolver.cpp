@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+
+#include "TreeDecompositionSolver.h"
+
+// Widest separator and count of entries of all tables at most, 64MB of memory
+const int maxTableWidth = 24;
+const long long maxTableEntryCount = 1LL << maxTableWidth;
+
+// Count of pairs of neighbors of vertex not adjacent to each other, the edges its elimination adds
+int countEliminationFill(const std::vector<std::set<int>> &adjacency, int vertex) {
+    const std::set<int> &neighbors = adjacency[vertex];
+    int nFill = 0;
+    for (auto first = neighbors.begin(); first != neighbors.end(); first++) {
+        auto second = first;
+        for (second++; second != neighbors.end(); second++) {
+            if (adjacency[*first].count(*second) == 0) {
+                nFill++;
+            }
+        }
+    }
+    return nFill;
+}
+
+TreeDecompositionSolver::TreeDecompositionSolver(const Graph &graph, int maxWidth) : graph(graph) {
+    this->nVertex = graph.GetVertexCount();
+    this->width = -1;
+
+    // a wider bag alone has more table entries than allowed
+    if (!this->eliminate(std::min(maxWidth, maxTableWidth))) {
+        return;
+    }
+
+    // a vertex of the separator is either the parent or in the separator of the parent, since the parent is eliminated first
+    auto positions = std::vector<int>(this->nVertex + 1, 0);
+    for (int i = 0; i < this->nVertex; i++) {
+        positions[this->order[i]] = i;
+    }
+    this->children = std::vector<std::vector<int>>(this->nVertex + 1);
+    this->choiceBits = std::vector<std::vector<int>>(this->nVertex + 1);
+    long long nTableEntry = 0;
+    int maxSeparatorSize = 0;
+    for (int i = 0; i < this->nVertex; i++) {
+        int vertex = this->order[i];
+        std::vector<int> &separator = this->separators[vertex];
+        std::sort(separator.begin(), separator.end(), [&positions](int a, int b) {
+            return positions[a] < positions[b];
+        });
+        nTableEntry += 1LL << separator.size();
+        maxSeparatorSize = std::max(maxSeparatorSize, (int)separator.size());
+    }
+    if (nTableEntry > maxTableEntryCount) {
+        return;
+    }
+
+    for (int i = 0; i < this->nVertex; i++) {
+        int vertex = this->order[i];
+        const std::vector<int> &separator = this->separators[vertex];
+        if (separator.empty()) {
+            continue;
+        }
+        int parent = separator[0];
+        const std::vector<int> &parentSeparator = this->separators[parent];
+        this->children[parent].push_back(vertex);
+        for (auto member : separator) {
+            if (member == parent) {
+                this->choiceBits[vertex].push_back(0);
+            } else {
+                auto position = std::lower_bound(parentSeparator.begin(), parentSeparator.end(), member, [&positions](int a, int b) {
+                    return positions[a] < positions[b];
+                });
+                this->choiceBits[vertex].push_back(position - parentSeparator.begin() + 1);
+            }
+        }
+    }
+    this->width = maxSeparatorSize;
+}
+
+bool TreeDecompositionSolver::IsDecomposed() const {
+    return this->width >= 0;
+}
+
+int TreeDecompositionSolver::GetWidth() const {
+    return this->width;
+}
+
+void TreeDecompositionSolver::SetCancellationToken(const std::shared_ptr<CancellationToken> &token) {
+    this->cancellationToken = token;
+}
+
+bool TreeDecompositionSolver::eliminate(int maxWidth) {
+    // treewidth is at least the smallest degree, which rejects a dense graph before building anything
+    int minDegree = this->nVertex;
+    for (int i = 1; i <= this->nVertex; i++) {
+        int degree = this->graph.GetNeighborsEnd(i) - this->graph.GetNeighborsBegin(i);
+        if (std::binary_search(this->graph.GetNeighborsBegin(i), this->graph.GetNeighborsEnd(i), i)) {
+            degree--;
+        }
+        minDegree = std::min(minDegree, degree);
+    }
+    if (minDegree > maxWidth) {
+        return false;
+    }
+
+    auto adjacency = std::vector<std::set<int>>(this->nVertex + 1);
+    for (int i = 1; i <= this->nVertex; i++) {
+        for (const int *neighbor = this->graph.GetNeighborsBegin(i); neighbor != this->graph.GetNeighborsEnd(i); neighbor++) {
+            if (*neighbor != i) {
+                adjacency[i].insert(*neighbor);
+            }
+        }
+    }
+
+    // vertices by fill edges their elimination adds, then by neighbor count
+    // a vertex of more than maxWidth neighbors cannot be eliminated, so it is last without counting its fill
+    auto keys = std::vector<std::tuple<int, int, int>>(this->nVertex + 1);
+    auto queue = std::set<std::tuple<int, int, int>>();
+    auto updateKey = [&](int vertex, bool isQueued) {
+        if (isQueued) {
+            queue.erase(keys[vertex]);
+        }
+        int nNeighbor = adjacency[vertex].size();
+        int nFill = nNeighbor > maxWidth ? std::numeric_limits<int>::max() : countEliminationFill(adjacency, vertex);
+        keys[vertex] = std::make_tuple(nFill, nNeighbor, vertex);
+        queue.insert(keys[vertex]);
+    };
+    for (int i = 1; i <= this->nVertex; i++) {
+        updateKey(i, false);
+    }
+
+    // the neighbors of an eliminated vertex become a clique, so their bags cover its edges
+    this->order.clear();
+    this->separators = std::vector<std::vector<int>>(this->nVertex + 1);
+    auto isEliminated = std::vector<bool>(this->nVertex + 1, false);
+    auto affected = std::set<int>();
+    while (!queue.empty()) {
+        int vertex = std::get<2>(*queue.begin());
+        queue.erase(queue.begin());
+        if ((int)adjacency[vertex].size() > maxWidth) {
+            return false;
+        }
+
+        this->order.push_back(vertex);
+        isEliminated[vertex] = true;
+        std::vector<int> &separator = this->separators[vertex];
+        separator.assign(adjacency[vertex].begin(), adjacency[vertex].end());
+
+        // fill changes for the neighbors, and for vertices next to two of them, which may have become adjacent
+        affected.clear();
+        for (auto neighbor : separator) {
+            adjacency[neighbor].erase(vertex);
+            adjacency[neighbor].insert(separator.begin(), separator.end());
+            adjacency[neighbor].erase(neighbor);
+        }
+        for (auto neighbor : separator) {
+            affected.insert(neighbor);
+            if ((int)adjacency[neighbor].size() <= maxWidth) {
+                affected.insert(adjacency[neighbor].begin(), adjacency[neighbor].end());
+            }
+        }
+        for (auto affectedVertex : affected) {
+            if (!isEliminated[affectedVertex]) {
+                updateKey(affectedVertex, true);
+            }
+        }
+        std::set<int>().swap(adjacency[vertex]);
+    }
+    return true;
+}
+
+int TreeDecompositionSolver::getChildIndex(int child, int choice) const {
+    const std::vector<int> &bits = this->choiceBits[child];
+    int index = 0;
+    for (size_t i = 0; i < bits.size(); i++) {
+        index |= ((choice >> bits[i]) & 1) << i;
+    }
+    return index;
+}
+
+int TreeDecompositionSolver::getSubtreeSize(int vertex, int separatorChoice, bool isTaken) const {
+    int choice = (separatorChoice << 1) | (isTaken ? 1 : 0);
+    int size = isTaken ? 1 : 0;
+    for (auto child : this->children[vertex]) {
+        size += this->tables[child][this->getChildIndex(child, choice)];
+    }
+    return size;
+}
+
+std::vector<int> TreeDecompositionSolver::Solve() {
+    if (!this->IsDecomposed()) {
+        throw std::invalid_argument("graph is not decomposed within the width");
+    }
+
+    // bit of every separator vertex which must be taken if vertex is not, for the edges from vertex to vertices eliminated later
+    auto neighborMasks = std::vector<int>(this->nVertex + 1, 0);
+    auto hasSelfLoop = std::vector<bool>(this->nVertex + 1, false);
+    for (int i = 1; i <= this->nVertex; i++) {
+        hasSelfLoop[i] = std::binary_search(this->graph.GetNeighborsBegin(i), this->graph.GetNeighborsEnd(i), i);
+        const std::vector<int> &separator = this->separators[i];
+        for (size_t j = 0; j < separator.size(); j++) {
+            if (std::binary_search(this->graph.GetNeighborsBegin(i), this->graph.GetNeighborsEnd(i), separator[j])) {
+                neighborMasks[i] |= 1 << j;
+            }
+        }
+    }
+
+    // children are eliminated before their parent, so tables are filled in elimination order
+    this->tables = std::vector<std::vector<int>>(this->nVertex + 1);
+    for (auto vertex : this->order) {
+        if (this->cancellationToken) {
+            this->cancellationToken->ThrowIfCancelled();
+        }
+
+        std::vector<int> &table = this->tables[vertex];
+        table.resize(1 << this->separators[vertex].size());
+        for (int choice = 0; choice < (int)table.size(); choice++) {
+            table[choice] = this->getSubtreeSize(vertex, choice, true);
+            if (!hasSelfLoop[vertex] && (choice & neighborMasks[vertex]) == neighborMasks[vertex]) {
+                table[choice] = std::min(table[choice], this->getSubtreeSize(vertex, choice, false));
+            }
+        }
+    }
+
+    // choices are made from the roots down, each vertex taken only if that is needed for the smallest size of its table
+    auto isInCover = std::vector<bool>(this->nVertex + 1, false);
+    for (int i = this->nVertex - 1; i >= 0; i--) {
+        int vertex = this->order[i];
+        const std::vector<int> &separator = this->separators[vertex];
+        int choice = 0;
+        for (size_t j = 0; j < separator.size(); j++) {
+            if (isInCover[separator[j]]) {
+                choice |= 1 << j;
+            }
+        }
+        bool canSkip = !hasSelfLoop[vertex] && (choice & neighborMasks[vertex]) == neighborMasks[vertex];
+        isInCover[vertex] = !canSkip || this->getSubtreeSize(vertex, choice, false) != this->tables[vertex][choice];
+    }
+
+    auto result = std::vector<int>();
+    for (int i = 1; i <= this->nVertex; i++) {
+        if (isInCover[i]) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
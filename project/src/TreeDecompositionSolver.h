@@ -0,0 +1,82 @@
+#ifndef TREE_DECOMPOSITION_SOLVER_H
+#define TREE_DECOMPOSITION_SOLVER_H
+
+#include <memory>
+#include <vector>
+
+#include "CancellationToken.h"
+#include "Graph.h"
+
+/*
+Exact minimum vertex cover of a graph of small treewidth, by dynamic programming over a tree decomposition
+The decomposition comes from a min-fill elimination order, ties broken by min-degree: the bag of each vertex is itself and its neighbors
+when it is eliminated, and its parent bag is that of the first of those neighbors eliminated after it
+Each bag keeps a table of the smallest cover of the vertices eliminated in its subtree for every choice of the neighbors,
+so time and memory are linear in the vertex count and exponential in the width only
+*/
+class TreeDecompositionSolver {
+public:
+    // Largest width of decompositions solved by default
+    static const int defaultMaxWidth = 16;
+
+    /*
+    Find a decomposition of graph of width at most maxWidth, see IsDecomposed
+    */
+    TreeDecompositionSolver(const Graph &graph, int maxWidth);
+
+    /*
+    Return true if the decomposition found has width at most maxWidth, and its tables fit in memory
+    */
+    bool IsDecomposed() const;
+
+    /*
+    Return width of the decomposition, the largest bag size less 1, or -1 if it is not decomposed
+    */
+    int GetWidth() const;
+
+    /*
+    Cancel Solve with token, it throws OperationCancelled once the token is cancelled
+    */
+    void SetCancellationToken(const std::shared_ptr<CancellationToken> &token);
+
+    /*
+    Return minimal vertex cover in ascending order
+    Throws std::invalid_argument if the graph is not decomposed
+    */
+    std::vector<int> Solve();
+
+private:
+    const Graph &graph;
+
+    int nVertex;
+
+    std::shared_ptr<CancellationToken> cancellationToken;
+
+    int width;
+
+    // Vertices in elimination order
+    std::vector<int> order;
+
+    // Neighbors of each vertex when it is eliminated, in elimination order. The first element is ignored
+    std::vector<std::vector<int>> separators;
+
+    // Vertices whose parent bag is the bag of each vertex. The first element is ignored
+    std::vector<std::vector<int>> children;
+
+    // Bit of each separator vertex of a vertex, in the choice of its parent bag's vertex as bit 0 and separator as the bits above
+    std::vector<std::vector<int>> choiceBits;
+
+    // Smallest cover of the subtree of each vertex, indexed by the vertices of its separator taken as bits
+    std::vector<std::vector<int>> tables;
+
+    // Eliminate vertices adding fewest fill edges first, return false once one has more than maxWidth neighbors
+    bool eliminate(int maxWidth);
+
+    // Index of the table of child, from the choice of its parent bag
+    int getChildIndex(int child, int choice) const;
+
+    // Smallest cover of the subtree of vertex given the choice of its separator, with vertex taken or not
+    int getSubtreeSize(int vertex, int separatorChoice, bool isTaken) const;
+};
+
+#endif
@@ -1,55 +1,133 @@
 #include <chrono>
 #include <iostream>
 #include <pthread.h>
-#include <sstream>
 #include <unistd.h>
 
 #include "Graph.h"
+#include "OutputBuffer.h"
+#include "ResultCache.h"
+#include "ThreadPool.h"
+#include "TreeDecompositionSolver.h"
 #include "VertexCoverSolver.h"
 
-pthread_cond_t pthread_cond_cnf_sat = PTHREAD_COND_INITIALIZER;
-pthread_mutex_t pthread_mutex_cnf_sat = PTHREAD_MUTEX_INITIALIZER;
-
 typedef struct thread_payload {
     std::shared_ptr<Graph> graph;
+    // Known cover used as the starting upper bound by the exact method
+    std::vector<int> upperBoundCover;
+    // Exact method to run, for the exact payload only
+    ExactMethod exactMethod;
     std::vector<int> result;
     bool isTimeout;
     int timeSpentInMicroseconds;
 } thread_payload_t;
 
+const int defaultResultCacheCapacity = 256;
+
+// Labels and line breaks of the output, at most
+const size_t outputLabelsLength = 64;
+
 VertexCoverSolver::VertexCoverSolver() {
     this->state = 0;
     this->nVertex = 0;
     this->timeoutInSeconds = 120;
+    this->cardinalityEncoding = CardinalityEncoding::Auto;
+    this->exactMethod = ExactMethod::CNF_SAT;
+    this->isFastPathEnabled = true;
+    this->maxTreewidth = TreeDecompositionSolver::defaultMaxWidth;
+    this->isSolvingOnCallingThread = false;
+    this->resultCache = std::make_shared<ResultCache>(defaultResultCacheCapacity);
     this->parser = std::unique_ptr<Parser>(new Parser());
 }
 
+ExactMethod ParseExactMethod(const std::string &name) {
+    if (name == "cnf-sat") {
+        return ExactMethod::CNF_SAT;
+    }
+    if (name == "branch-and-bound") {
+        return ExactMethod::BranchAndBound;
+    }
+    throw std::invalid_argument("unknown exact method");
+}
+
+void VertexCoverSolver::SetExactMethod(ExactMethod method) {
+    this->exactMethod = method;
+}
+
+void VertexCoverSolver::SetFastPaths(bool isFastPathEnabled) {
+    this->isFastPathEnabled = isFastPathEnabled;
+}
+
+void VertexCoverSolver::SetMaxTreewidth(int maxTreewidth) {
+    this->maxTreewidth = maxTreewidth;
+}
+
+void VertexCoverSolver::SetCardinalityEncoding(CardinalityEncoding encoding) {
+    this->cardinalityEncoding = encoding;
+}
+
+void VertexCoverSolver::SetSolvingOnCallingThread(bool isSolvingOnCallingThread) {
+    this->isSolvingOnCallingThread = isSolvingOnCallingThread;
+}
+
+void VertexCoverSolver::SetCoverCacheFile(const std::shared_ptr<CoverCacheFile> &coverCacheFile) {
+    this->coverCacheFile = coverCacheFile;
+}
+
+void VertexCoverSolver::SetResultCacheCapacity(int capacity) {
+    this->resultCache = capacity > 0 ? std::make_shared<ResultCache>(capacity) : nullptr;
+}
+
 int getMicroseconds(timespec ts_start, timespec ts_end) {
     return (ts_end.tv_sec - ts_start.tv_sec) * 1000 * 1000 + (ts_end.tv_nsec - ts_start.tv_nsec) / 1000;
 }
 
-std::string VertexCoverSolver::AcceptLine(std::string line) {
-    // removing heading and tailing spaces
-    unsigned cmdStart = 0;
-    while (cmdStart < line.size() && line[cmdStart] == ' ') {
-        cmdStart++;
+const std::vector<int> &getSmallerCover(const std::vector<int> &cover_1, const std::vector<int> &cover_2) {
+    return cover_1.size() <= cover_2.size() ? cover_1 : cover_2;
+}
+
+std::string VertexCoverSolver::AcceptLine(const std::string &line) {
+    auto solve = this->AcceptLineDeferred(line);
+    if (!solve) {
+        return "";
+    }
+    return solve();
+}
+
+std::function<std::string()> VertexCoverSolver::AcceptLineDeferred(const std::string &line) {
+    return this->AcceptLineDeferred(line.data(), line.data() + line.size());
+}
+
+std::function<std::string()> VertexCoverSolver::AcceptLineDeferred(const char *begin, const char *end) {
+    auto graph = this->acceptLineGraph(begin, end);
+    if (!graph) {
+        return nullptr;
     }
-    if (cmdStart == line.size()) {
+    return this->AcceptGraphDeferred(graph);
+}
+
+std::shared_ptr<Graph> VertexCoverSolver::AcceptLineGraph(const std::string &line) {
+    return this->acceptLineGraph(line.data(), line.data() + line.size());
+}
+
+std::shared_ptr<Graph> VertexCoverSolver::acceptLineGraph(const char *begin, const char *end) {
+    // removing heading and tailing spaces, the command is parsed in place since lines may be large
+    while (begin != end && *begin == ' ') {
+        begin++;
+    }
+    if (begin == end) {
         // empty line or only spaces
-        return "";
+        return nullptr;
     }
-    unsigned cmdEnd = line.size() - 1;
-    while (cmdEnd > cmdStart && line[cmdEnd] == ' ') {
-        cmdEnd--;
+    while (end[-1] == ' ') {
+        end--;
     }
-    line = line.substr(cmdStart, cmdEnd - cmdStart + 1);
 
     if (state == 0) {
         // Accepting "V ..."
         state = 1;
         this->nVertex = 0;
-        nVertex = this->parser->GetVertexCount(line);
-        return "";
+        nVertex = this->parser->GetVertexCount(begin, end);
+        return nullptr;
     }
     else {
         // Accepting "E ..."
@@ -58,172 +136,245 @@ std::string VertexCoverSolver::AcceptLine(std::string line) {
             throw std::invalid_argument("V is already invalid, thus invalidating E");
         }
 
-        auto edges = this->parser->GetEdges(line, nVertex);
-        auto graph = std::shared_ptr<Graph>(new Graph(nVertex, edges));
-
-        // Create threads and run with different methods
-        pthread_t thread_approx_1, thread_approx_2, thread_cnf_sat;
-        thread_payload_t thread_payload_approx_1 = {
-            .graph = graph,
-            .result = std::vector<int>(),
-            .isTimeout = false,
-            .timeSpentInMicroseconds = 0
-        };
-        thread_payload_t thread_payload_approx_2 = {
-            .graph = graph,
-            .result = std::vector<int>(),
-            .isTimeout = false,
-            .timeSpentInMicroseconds = 0
-        };
-
-        // Manually new this instance to hold a reference for graph shared_ptr so that the graph remains in heap after the function stack is cleaned up
-        thread_payload_t *thread_payload_cnf_sat = new thread_payload_t {
-            .graph = graph,
-            .result = std::vector<int>(),
-            .isTimeout = false,
-            .timeSpentInMicroseconds = 0
-        };
-
-        auto thread_func_approx_1 = [](void *data) -> void* {
-            thread_payload_t *payload =(thread_payload_t*)data;
-
-            clockid_t cid;
-            struct timespec ts_start, ts_end;
-            pthread_getcpuclockid(pthread_self(), &cid);
-
-            clock_gettime(cid, &ts_start);
-            payload->graph->getVertexCoverWithAPPROX_VC_1(payload->result);
-            clock_gettime(cid, &ts_end);
-
-            payload->timeSpentInMicroseconds = getMicroseconds(ts_start, ts_end);
-            return nullptr;
-        };
-
-        auto thread_func_approx_2 = [](void *data) -> void* {
-            thread_payload_t *payload =(thread_payload_t*)data;
-
-            clockid_t cid;
-            struct timespec ts_start, ts_end;
-            pthread_getcpuclockid(pthread_self(), &cid);
-
-            clock_gettime(cid, &ts_start);
-            payload->graph->getVertexCoverWithAPPROX_VC_2(payload->result);
-            clock_gettime(cid, &ts_end);
-
-            payload->timeSpentInMicroseconds = getMicroseconds(ts_start, ts_end);
-            return nullptr;
-        };
-
-        auto thread_func_cnf_sat = [](void *data) -> void* {
-            thread_payload_t *payload =(thread_payload_t*)data;
-
-            clockid_t cid;
-            struct timespec ts_start, ts_end;
-            pthread_getcpuclockid(pthread_self(), &cid);
-
-            clock_gettime(cid, &ts_start);
-            auto result = payload->graph->GetMinimalVertexCover_CNF_SAT();
-            clock_gettime(cid, &ts_end);
-
-            pthread_mutex_lock(&pthread_mutex_cnf_sat);
-
-            if (payload->isTimeout) {
-                delete payload;
-            } else {
-                payload->result = result;
-                payload->timeSpentInMicroseconds = getMicroseconds(ts_start, ts_end);
-                pthread_cond_signal(&pthread_cond_cnf_sat);
-            }
-
-            pthread_mutex_unlock(&pthread_mutex_cnf_sat);
+        return std::make_shared<Graph>(nVertex, this->parser->GetEdges(begin, end, nVertex));
+    }
+}
 
-            return nullptr;
-        };
+bool VertexCoverSolver::IsExpectingEdges() const {
+    return this->state == 1;
+}
 
-        int ret = 0;
-        ret = pthread_create(&thread_approx_1, nullptr, thread_func_approx_1, &thread_payload_approx_1);
-        if (ret != 0) {
-            throw std::runtime_error("error starting approx_1 thread");
-        }
-        ret = pthread_create(&thread_approx_2, nullptr, thread_func_approx_2, &thread_payload_approx_2);
-        if (ret != 0) {
-            throw std::runtime_error("error starting approx_2 thread");
-        }
+std::unique_ptr<EdgeLineStream> VertexCoverSolver::CreateEdgeLineStream() const {
+    return std::unique_ptr<EdgeLineStream>(new EdgeLineStream(this->nVertex));
+}
 
-        pthread_mutex_lock(&pthread_mutex_cnf_sat);
+std::function<std::string()> VertexCoverSolver::AcceptEdgeLineStreamDeferred(EdgeLineStream &stream) {
+    if (stream.IsBlank()) {
+        return nullptr;
+    }
 
-        ret = pthread_create(&thread_cnf_sat, nullptr, thread_func_cnf_sat, thread_payload_cnf_sat);
-        if (ret != 0) {
-            throw std::runtime_error("error starting cnf_sat thread");
-        }
+    state = 0;
+    if (nVertex < 2) {
+        throw std::invalid_argument("V is already invalid, thus invalidating E");
+    }
 
-        timespec wait_until_cnf_sat = {
-            .tv_sec = this->timeoutInSeconds,
-            .tv_nsec = 0
-        };
+    return this->AcceptGraphDeferred(std::make_shared<Graph>(nVertex, stream.Finish()));
+}
 
-        auto currentTime = std::chrono::system_clock::now();
-        wait_until_cnf_sat.tv_sec += std::chrono::system_clock::to_time_t(currentTime);
+std::function<std::string()> VertexCoverSolver::AcceptGraphDeferred(const std::shared_ptr<Graph> &graph) {
+    graph->SetCardinalityEncoding(this->cardinalityEncoding);
+    graph->SetFastPaths(this->isFastPathEnabled);
+    graph->SetMaxTreewidth(this->maxTreewidth);
+
+    SolveSettings settings;
+    settings.timeoutInSeconds = this->timeoutInSeconds;
+    settings.isSolvingOnCallingThread = this->isSolvingOnCallingThread;
+    settings.exactMethod = this->exactMethod;
+    settings.resultCache = this->resultCache;
+    settings.coverCacheFile = this->coverCacheFile;
+    return [graph, settings]() {
+        return VertexCoverSolver::solveGraph(graph, settings);
+    };
+}
 
-        if (0 != pthread_cond_timedwait(&pthread_cond_cnf_sat, &pthread_mutex_cnf_sat, &wait_until_cnf_sat)) {
-            thread_payload_cnf_sat->isTimeout = true;
-            pthread_detach(thread_cnf_sat);
-        }
+std::string VertexCoverSolver::solveGraph(const std::shared_ptr<Graph> &graph, const SolveSettings &settings) {
+    const std::shared_ptr<ResultCache> &resultCache = settings.resultCache;
+    const std::shared_ptr<CoverCacheFile> &coverCacheFile = settings.coverCacheFile;
 
-        pthread_mutex_unlock(&pthread_mutex_cnf_sat);
+    // A graph seen before is answered with its covers from then, without solving
+    GraphFingerprint fingerprint;
+    CachedCovers covers;
+    if (resultCache || coverCacheFile) {
+        fingerprint = GetGraphFingerprint(*graph);
+    }
+    if (resultCache && resultCache->Find(fingerprint, covers)) {
+        return VertexCoverSolver::formatOutput(covers, settings.exactMethod, false);
+    }
 
-        pthread_join(thread_approx_1, NULL);
-        pthread_join(thread_approx_2, NULL);
-        if (!thread_payload_cnf_sat->isTimeout) {
-            pthread_join(thread_cnf_sat, NULL);
+    // Cancelled at the timeout, so the exact method stops solving and frees its thread
+    auto cancellationToken = std::make_shared<CancellationToken>();
+    graph->SetCancellationToken(cancellationToken);
+
+    thread_payload_t thread_payload_approx_1 = {
+        .graph = graph,
+        .upperBoundCover = std::vector<int>(),
+        .exactMethod = settings.exactMethod,
+        .result = std::vector<int>(),
+        .isTimeout = false,
+        .timeSpentInMicroseconds = 0
+    };
+    thread_payload_t thread_payload_approx_2 = {
+        .graph = graph,
+        .upperBoundCover = std::vector<int>(),
+        .exactMethod = settings.exactMethod,
+        .result = std::vector<int>(),
+        .isTimeout = false,
+        .timeSpentInMicroseconds = 0
+    };
+    thread_payload_t thread_payload_exact = {
+        .graph = graph,
+        .upperBoundCover = std::vector<int>(),
+        .exactMethod = settings.exactMethod,
+        .result = std::vector<int>(),
+        .isTimeout = false,
+        .timeSpentInMicroseconds = 0
+    };
+
+    auto task_approx_1 = [&thread_payload_approx_1]() {
+        thread_payload_t *payload = &thread_payload_approx_1;
+
+        clockid_t cid;
+        struct timespec ts_start, ts_end;
+        pthread_getcpuclockid(pthread_self(), &cid);
+
+        clock_gettime(cid, &ts_start);
+        payload->graph->getVertexCoverWithAPPROX_VC_1(payload->result);
+        clock_gettime(cid, &ts_end);
+
+        payload->timeSpentInMicroseconds = getMicroseconds(ts_start, ts_end);
+    };
+
+    auto task_approx_2 = [&thread_payload_approx_2]() {
+        thread_payload_t *payload = &thread_payload_approx_2;
+
+        clockid_t cid;
+        struct timespec ts_start, ts_end;
+        pthread_getcpuclockid(pthread_self(), &cid);
+
+        clock_gettime(cid, &ts_start);
+        payload->graph->getVertexCoverWithAPPROX_VC_2(payload->result);
+        clock_gettime(cid, &ts_end);
+
+        payload->timeSpentInMicroseconds = getMicroseconds(ts_start, ts_end);
+    };
+
+    auto task_exact = [&thread_payload_exact]() {
+        thread_payload_t *payload = &thread_payload_exact;
+
+        clockid_t cid;
+        struct timespec ts_start, ts_end;
+        pthread_getcpuclockid(pthread_self(), &cid);
+
+        clock_gettime(cid, &ts_start);
+        try {
+            if (payload->exactMethod == ExactMethod::BranchAndBound) {
+                payload->result = payload->graph->GetMinimalVertexCover_BranchAndBound(payload->upperBoundCover);
+            } else {
+                payload->result = payload->graph->GetMinimalVertexCover_CNF_SAT(payload->upperBoundCover);
+            }
         }
-
-        // Construct result
-        std::stringstream ss = std::stringstream();
-
-        ss << "CNF-SAT-VC: ";
-        if (thread_payload_cnf_sat->isTimeout) {
-            // payload is to be deleted in the detached thread when timeout happens so the graph remains in heap during its solving process
-            ss << "timeout";
-        } else{
-            this->appendResult(ss, thread_payload_cnf_sat->result);
-            delete thread_payload_cnf_sat;
+        catch (const OperationCancelled &) {
+            payload->isTimeout = true;
         }
-        ss << std::endl;
-
-        ss << "APPROX-VC-1: ";
-        this->appendResult(ss, thread_payload_approx_1.result);
-        ss << std::endl;
-
-        ss << "APPROX-VC-2: ";
-        this->appendResult(ss, thread_payload_approx_2.result);
-        ss << std::endl;
+        clock_gettime(cid, &ts_end);
+
+        payload->timeSpentInMicroseconds = getMicroseconds(ts_start, ts_end);
+    };
+
+    // A minimum cover solved by an earlier run replaces the exact method. It is checked against the approximations,
+    // so a damaged or outdated file never gives a cover larger than they do, or one that is not a cover at all
+    bool isExactFromFile = false;
+    auto findExactInFile = [&]() {
+        if (coverCacheFile && coverCacheFile->Find(fingerprint, thread_payload_exact.result)) {
+            isExactFromFile = graph->IsMinimalVertexCoverCandidate(thread_payload_exact.result, thread_payload_exact.upperBoundCover);
+            if (!isExactFromFile) {
+                thread_payload_exact.result.clear();
+            }
+        }
+    };
+
+    if (settings.isSolvingOnCallingThread) {
+        // The better approximation bounds the exact search from above, so it is started after both approximations are done
+        task_approx_1();
+        task_approx_2();
+        thread_payload_exact.upperBoundCover = getSmallerCover(thread_payload_approx_1.result, thread_payload_approx_2.result);
+        findExactInFile();
+
+        if (!isExactFromFile) {
+            // No thread waits for the timeout, the solver cancels itself once the deadline passes
+            cancellationToken->SetDeadline(std::chrono::steady_clock::now() + std::chrono::seconds(settings.timeoutInSeconds));
+            task_exact();
+        }
+    } else {
+        ThreadPool &pool = ThreadPool::Shared();
+        auto future_approx_1 = pool.Submit(task_approx_1);
+        auto future_approx_2 = pool.Submit(task_approx_2);
+
+        // Both tasks refer to payloads on this stack, so both are waited for before any exception is rethrown
+        future_approx_1.wait();
+        future_approx_2.wait();
+        future_approx_1.get();
+        future_approx_2.get();
+        thread_payload_exact.upperBoundCover = getSmallerCover(thread_payload_approx_1.result, thread_payload_approx_2.result);
+        findExactInFile();
+
+        if (!isExactFromFile) {
+            auto future_exact = pool.Submit(task_exact);
+            if (future_exact.wait_for(std::chrono::seconds(settings.timeoutInSeconds)) == std::future_status::timeout) {
+                // Interrupt the solver instead of leaving the task running, it returns shortly after
+                cancellationToken->Cancel();
+            }
+            future_exact.get();
+        }
+    }
 
-        // Uncomment to print performance data
-        /*
-        if (!thread_payload_cnf_sat->isTimeout) {
-            std::cout << "CNF-SAT-VC(microsecond): " << thread_payload_cnf_sat->timeSpentInMicroseconds << std::endl;
+    if (coverCacheFile && !isExactFromFile && !thread_payload_exact.isTimeout) {
+        try {
+            coverCacheFile->Insert(fingerprint, thread_payload_exact.result);
         }
-        std::cout << "APPROX-VC-1(microsecond): " << thread_payload_approx_1.timeSpentInMicroseconds << std::endl;
-        std::cout << "APPROX-VC-2(microsecond): " << thread_payload_approx_2.timeSpentInMicroseconds << std::endl;
-        std::cout << "APPROX-VC-1(size): " << thread_payload_approx_1.result.size() << std::endl;
-        std::cout << "APPROX-VC-2(size): " << thread_payload_approx_2.result.size() << std::endl;
-        if (!thread_payload_cnf_sat->isTimeout) {
-            std::cout << "CNF-SAT-VC(size): " << thread_payload_cnf_sat->result.size() << std::endl;
-            std::cout << "APPROX-VC-1(ratio): " << (float)thread_payload_approx_1.result.size() / thread_payload_cnf_sat->result.size() << std::endl;
-            std::cout << "APPROX-VC-2(ratio): " << (float)thread_payload_approx_2.result.size() / thread_payload_cnf_sat->result.size() << std::endl;
+        catch (std::runtime_error &) {
+            // the cover is still output, it is only solved again by the next run
         }
-        */
+    }
 
-        return ss.str();
+    // Uncomment to print performance data
+    /*
+    if (!thread_payload_exact.isTimeout) {
+        std::cout << "CNF-SAT-VC(microsecond): " << thread_payload_exact.timeSpentInMicroseconds << std::endl;
+    }
+    std::cout << "APPROX-VC-1(microsecond): " << thread_payload_approx_1.timeSpentInMicroseconds << std::endl;
+    std::cout << "APPROX-VC-2(microsecond): " << thread_payload_approx_2.timeSpentInMicroseconds << std::endl;
+    std::cout << "APPROX-VC-1(size): " << thread_payload_approx_1.result.size() << std::endl;
+    std::cout << "APPROX-VC-2(size): " << thread_payload_approx_2.result.size() << std::endl;
+    if (!thread_payload_exact.isTimeout) {
+        std::cout << "CNF-SAT-VC(size): " << thread_payload_exact.result.size() << std::endl;
+        std::cout << "APPROX-VC-1(ratio): " << (float)thread_payload_approx_1.result.size() / thread_payload_exact.result.size() << std::endl;
+        std::cout << "APPROX-VC-2(ratio): " << (float)thread_payload_approx_2.result.size() / thread_payload_exact.result.size() << std::endl;
     }
+    */
+
+    covers.exact.swap(thread_payload_exact.result);
+    covers.approx_1.swap(thread_payload_approx_1.result);
+    covers.approx_2.swap(thread_payload_approx_2.result);
+    // a timeout depends on the load of the machine, so the graph is tried again next time
+    if (resultCache && !thread_payload_exact.isTimeout) {
+        resultCache->Insert(fingerprint, covers);
+    }
+
+    return VertexCoverSolver::formatOutput(covers, settings.exactMethod, thread_payload_exact.isTimeout);
 }
 
-void VertexCoverSolver::appendResult(std::stringstream &ss, const std::vector<int> &result) {
-    if (result.size() > 0) {
-        ss << result[0];
-        for (unsigned i = 1; i < result.size(); i++) {
-            ss << "," << result[i];
-        }
+std::string VertexCoverSolver::formatOutput(const CachedCovers &covers, ExactMethod exactMethod, bool isExactTimeout) {
+    // Reserved for all three lines, so the text is allocated once and moved out without a copy
+    OutputBuffer output;
+    output.Reserve(outputLabelsLength + OutputBuffer::GetListLength(covers.exact)
+        + OutputBuffer::GetListLength(covers.approx_1) + OutputBuffer::GetListLength(covers.approx_2));
+
+    output.Append(exactMethod == ExactMethod::BranchAndBound ? "BNB-VC: " : "CNF-SAT-VC: ");
+    if (isExactTimeout) {
+        output.Append("timeout");
+    } else{
+        output.AppendList(covers.exact);
     }
+    output.Append('\n');
+
+    output.Append("APPROX-VC-1: ");
+    output.AppendList(covers.approx_1);
+    output.Append('\n');
+
+    output.Append("APPROX-VC-2: ");
+    output.AppendList(covers.approx_2);
+    output.Append('\n');
+
+    return output.TakeText();
 }
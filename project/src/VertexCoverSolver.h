@@ -1,11 +1,28 @@
 #ifndef VERTEX_COVER_SOLVER_H
 #define VERTEX_COVER_SOLVER_H
 
+#include <functional>
 #include <memory>
-#include <sstream>
 #include <string>
 
+#include "CardinalityEncoder.h"
+#include "CoverCacheFile.h"
+#include "Graph.h"
 #include "Parser.h"
+#include "ResultCache.h"
+
+enum class ExactMethod {
+    // Minisat on clauses of edges and a cardinality constraint, output as CNF-SAT-VC
+    CNF_SAT,
+    // BranchAndBoundSolver on the graph itself, output as BNB-VC
+    BranchAndBound
+};
+
+/*
+Return exact method of name, one of cnf-sat and branch-and-bound
+Throws std::invalid_argument if name is unknown
+*/
+ExactMethod ParseExactMethod(const std::string &name);
 
 // The main solver to calculate the vertex cover path
 class VertexCoverSolver {
@@ -17,7 +34,86 @@ public:
     For V command, store the vertex count, and return empty string.
     For E command, construct the graph and solve the problem, return the result.
     */
-    std::string AcceptLine(std::string AcceptLine);
+    std::string AcceptLine(const std::string &line);
+
+    /*
+    Same as AcceptLine, except that solving an E command is deferred
+    Return empty function if there is no output, otherwise the function solving the graph and returning the result
+    The function may be called from any thread, after this solver has accepted more lines
+    */
+    std::function<std::string()> AcceptLineDeferred(const std::string &line);
+
+    /*
+    Same as above, with the line in range [begin, end)
+    */
+    std::function<std::string()> AcceptLineDeferred(const char *begin, const char *end);
+
+    /*
+    Return true if the next line other than spaces is taken as E command
+    */
+    bool IsExpectingEdges() const;
+
+    /*
+    Return stream to read an E command in parts, when IsExpectingEdges
+    */
+    std::unique_ptr<EdgeLineStream> CreateEdgeLineStream() const;
+
+    /*
+    Same as AcceptLineDeferred, for an E command line read completely into stream
+    */
+    std::function<std::string()> AcceptEdgeLineStreamDeferred(EdgeLineStream &stream);
+
+    /*
+    Same as AcceptLineDeferred, except that the graph of an E command is returned instead of the function solving it
+    Return nullptr if there is no graph
+    */
+    std::shared_ptr<Graph> AcceptLineGraph(const std::string &line);
+
+    /*
+    Return the function solving graph and returning the result, with the settings of this solver
+    Used for graphs not read as command lines, such as graph files
+    */
+    std::function<std::string()> AcceptGraphDeferred(const std::shared_ptr<Graph> &graph);
+
+    /*
+    Select the exact method of every graph afterwards, CNF-SAT-VC by default
+    */
+    void SetExactMethod(ExactMethod method);
+
+    /*
+    Solve kernel components of every graph afterwards with a solver suiting their structure if there is one, instead of the exact method
+    On by default, see Graph::SetFastPaths
+    */
+    void SetFastPaths(bool isFastPathEnabled);
+
+    /*
+    Select the largest treewidth of kernel components solved by tree decomposition with fast paths, for graphs afterwards
+    */
+    void SetMaxTreewidth(int maxTreewidth);
+
+    /*
+    Select the cardinality encoding used by CNF-SAT-VC of every graph afterwards
+    */
+    void SetCardinalityEncoding(CardinalityEncoding encoding);
+
+    /*
+    Run all methods of a graph on the thread solving it, instead of the shared worker pool, for graphs afterwards
+    Used when graphs themselves are solved in parallel. The timeout of CNF-SAT-VC becomes a deadline checked by the solver
+    */
+    void SetSolvingOnCallingThread(bool isSolvingOnCallingThread);
+
+    /*
+    Keep covers of at most capacity graphs, so a graph with the same edges as one of them is answered without solving
+    A capacity of 0 disables the cache. Covers cached before are dropped. The cache keeps 256 graphs until this is called
+    */
+    void SetResultCacheCapacity(int capacity);
+
+    /*
+    Take the CNF-SAT-VC cover of a graph from coverCacheFile if it has one, and store covers solved otherwise, for graphs afterwards
+    A cover from the file is solved again unless it passes Graph::IsMinimalVertexCoverCandidate against the smaller approximation
+    nullptr stops using the file
+    */
+    void SetCoverCacheFile(const std::shared_ptr<CoverCacheFile> &coverCacheFile);
 
 private:
     // Internal state to decide which kind of command line to accept
@@ -26,14 +122,49 @@ private:
     // Vertex count of the current graph
     int nVertex;
 
-    // Timeout for CNF-SAT-VC
+    // Timeout for the exact method
     int timeoutInSeconds;
 
+    ExactMethod exactMethod;
+
+    // Indicates whether graphs solve kernel components with a solver suiting their structure
+    bool isFastPathEnabled;
+
+    // Largest treewidth of kernel components solved by tree decomposition
+    int maxTreewidth;
+
+    // Cardinality encoding for CNF-SAT-VC
+    CardinalityEncoding cardinalityEncoding;
+
+    // Indicates whether methods run on the calling thread instead of the shared worker pool
+    bool isSolvingOnCallingThread;
+
+    // Covers of graphs solved before, shared with the functions solving graphs. Empty if disabled
+    std::shared_ptr<ResultCache> resultCache;
+
+    // Minimum covers kept across runs, shared with the functions solving graphs. Empty if not used
+    std::shared_ptr<CoverCacheFile> coverCacheFile;
+
     // Parser to get the information from input
     std::unique_ptr<Parser> parser;
 
-    // Helper method to append result to output
-    void appendResult(std::stringstream &ss, const std::vector<int> &result);
+    // Build graph of the current vertex count from E command in range [begin, end), return nullptr for empty line and V command
+    std::shared_ptr<Graph> acceptLineGraph(const char *begin, const char *end);
+
+    // Settings of solving a graph, copied from this solver when the graph is accepted
+    struct SolveSettings {
+        int timeoutInSeconds;
+        bool isSolvingOnCallingThread;
+        ExactMethod exactMethod;
+        std::shared_ptr<ResultCache> resultCache;
+        std::shared_ptr<CoverCacheFile> coverCacheFile;
+    };
+
+    // Run all methods on graph, or take covers from the caches of settings if they have them, and return the output
+    static std::string solveGraph(const std::shared_ptr<Graph> &graph, const SolveSettings &settings);
+
+    // Output of covers, labelled by exactMethod, with timeout in place of the exact cover if isExactTimeout
+    static std::string formatOutput(const CachedCovers &covers, ExactMethod exactMethod, bool isExactTimeout);
 };
 
 #endif
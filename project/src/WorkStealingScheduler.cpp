@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "WorkStealingScheduler.h"
+
+// Scheduler and index of the worker running on this thread, null outside of workers
+thread_local WorkStealingScheduler *currentScheduler = nullptr;
+thread_local int currentWorkerIndex = -1;
+
+struct WorkerStart {
+    WorkStealingScheduler *scheduler;
+    int index;
+};
+
+WorkStealingScheduler::WorkStealingScheduler(int nThread) {
+    this->nextWorker = 0;
+    this->nQueued = 0;
+    this->nUnfinished = 0;
+    this->isStopping = false;
+    pthread_mutex_init(&this->mutex, nullptr);
+    pthread_cond_init(&this->taskCondition, nullptr);
+    pthread_cond_init(&this->finishCondition, nullptr);
+
+    // all deques exist before any worker may steal from them
+    nThread = std::max(1, nThread);
+    for (int i = 0; i < nThread; i++) {
+        this->workers.push_back(std::unique_ptr<Worker>(new Worker()));
+        pthread_mutex_init(&this->workers[i]->mutex, nullptr);
+    }
+    for (int i = 0; i < nThread; i++) {
+        if (pthread_create(&this->workers[i]->thread, nullptr, WorkStealingScheduler::workerMain, new WorkerStart {this, i}) != 0) {
+            throw std::runtime_error("error starting scheduler worker");
+        }
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    this->Wait();
+
+    pthread_mutex_lock(&this->mutex);
+    this->isStopping = true;
+    pthread_cond_broadcast(&this->taskCondition);
+    pthread_mutex_unlock(&this->mutex);
+
+    for (unsigned i = 0; i < this->workers.size(); i++) {
+        pthread_join(this->workers[i]->thread, nullptr);
+        pthread_mutex_destroy(&this->workers[i]->mutex);
+    }
+
+    pthread_cond_destroy(&this->finishCondition);
+    pthread_cond_destroy(&this->taskCondition);
+    pthread_mutex_destroy(&this->mutex);
+}
+
+int WorkStealingScheduler::GetThreadCount() const {
+    return this->workers.size();
+}
+
+void WorkStealingScheduler::Submit(const std::function<void()> &task) {
+    int index;
+    if (currentScheduler == this) {
+        index = currentWorkerIndex;
+    } else {
+        index = this->nextWorker++ % this->workers.size();
+    }
+
+    pthread_mutex_lock(&this->mutex);
+    this->nUnfinished++;
+    pthread_mutex_unlock(&this->mutex);
+
+    Worker &worker = *this->workers[index];
+    pthread_mutex_lock(&worker.mutex);
+    worker.tasks.push_back(task);
+    pthread_mutex_unlock(&worker.mutex);
+
+    pthread_mutex_lock(&this->mutex);
+    this->nQueued++;
+    pthread_cond_signal(&this->taskCondition);
+    pthread_mutex_unlock(&this->mutex);
+}
+
+void WorkStealingScheduler::Wait() {
+    pthread_mutex_lock(&this->mutex);
+    while (this->nUnfinished > 0) {
+        pthread_cond_wait(&this->finishCondition, &this->mutex);
+    }
+    pthread_mutex_unlock(&this->mutex);
+}
+
+bool WorkStealingScheduler::runOneTask(int index) {
+    int nWorker = this->workers.size();
+    std::function<void()> task;
+    for (int i = 0; i < nWorker && !task; i++) {
+        // own deque first, then the others starting from the next one
+        Worker &worker = *this->workers[(index + i) % nWorker];
+        pthread_mutex_lock(&worker.mutex);
+        if (!worker.tasks.empty()) {
+            if (i == 0) {
+                task = worker.tasks.back();
+                worker.tasks.pop_back();
+            } else {
+                task = worker.tasks.front();
+                worker.tasks.pop_front();
+            }
+        }
+        pthread_mutex_unlock(&worker.mutex);
+    }
+    if (!task) {
+        return false;
+    }
+    this->nQueued--;
+
+    task();
+
+    pthread_mutex_lock(&this->mutex);
+    this->nUnfinished--;
+    if (this->nUnfinished == 0) {
+        pthread_cond_broadcast(&this->finishCondition);
+    }
+    pthread_mutex_unlock(&this->mutex);
+    return true;
+}
+
+void *WorkStealingScheduler::workerMain(void *data) {
+    WorkerStart *start = (WorkerStart*)data;
+    WorkStealingScheduler *scheduler = start->scheduler;
+    int index = start->index;
+    delete start;
+
+    currentScheduler = scheduler;
+    currentWorkerIndex = index;
+
+    while (true) {
+        if (scheduler->runOneTask(index)) {
+            continue;
+        }
+
+        pthread_mutex_lock(&scheduler->mutex);
+        while (scheduler->nQueued == 0 && !scheduler->isStopping) {
+            pthread_cond_wait(&scheduler->taskCondition, &scheduler->mutex);
+        }
+        bool isDone = scheduler->nQueued == 0 && scheduler->isStopping;
+        pthread_mutex_unlock(&scheduler->mutex);
+
+        if (isDone) {
+            return nullptr;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef WORK_STEALING_SCHEDULER_H
+#define WORK_STEALING_SCHEDULER_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <pthread.h>
+#include <vector>
+
+/*
+Worker threads with a task deque each. A worker takes its newest task first, and steals the oldest task of another worker when its own deque is empty
+Tasks submitted from outside are spread over the workers in turn, tasks submitted by a task go to the deque of its worker
+*/
+class WorkStealingScheduler {
+public:
+    /*
+    Start nThread workers, at least one
+    */
+    explicit WorkStealingScheduler(int nThread);
+
+    /*
+    Finish all submitted tasks and join all workers
+    */
+    ~WorkStealingScheduler();
+
+    /*
+    Queue task, it must not throw
+    */
+    void Submit(const std::function<void()> &task);
+
+    /*
+    Return after all tasks submitted so far finish
+    */
+    void Wait();
+
+    int GetThreadCount() const;
+
+private:
+    struct Worker {
+        pthread_t thread;
+
+        // Tasks of this worker, guarded by mutex. The worker takes from the back and thieves from the front
+        std::deque<std::function<void()>> tasks;
+
+        pthread_mutex_t mutex;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Worker receiving the next task submitted from outside
+    std::atomic<unsigned> nextWorker;
+
+    // Count of tasks in all deques, increased under mutex so idle workers do not miss a task
+    std::atomic<int> nQueued;
+
+    // Count of tasks submitted and not finished yet, guarded by mutex
+    int nUnfinished;
+
+    bool isStopping;
+
+    pthread_mutex_t mutex;
+
+    // Signaled when a task is queued or the scheduler is stopping
+    pthread_cond_t taskCondition;
+
+    // Signaled when the last unfinished task finishes
+    pthread_cond_t finishCondition;
+
+    /*
+    Take a task for worker of index, from its own deque or another one, and run it
+    Return false if there is no task to take
+    */
+    bool runOneTask(int index);
+
+    static void *workerMain(void *data);
+};
+
+#endif
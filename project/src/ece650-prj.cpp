@@ -1,23 +1,147 @@
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
+#include "BatchSolver.h"
+#include "BufferedWriter.h"
+#include "GraphFile.h"
+#include "GraphFormatReader.h"
+#include "InputReader.h"
+#include "Parser.h"
 #include "VertexCoverSolver.h"
 
+// Return value of a non-negative int option, throws std::invalid_argument if it is not one
+int getOptionInt(const std::string &option, const std::string &value) {
+    IntAccumulator number;
+    for (unsigned i = 0; i < value.size(); i++) {
+        number.Push(value[i]);
+    }
+    if (!number.IsValidInt()) {
+        throw std::invalid_argument("invalid value of option " + option);
+    }
+    return number.GetValue();
+}
+
 int main(int argc, char** argv) {
+    // standard streams are not mixed with stdio, and output is flushed explicitly instead of before every read
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
     auto solver = std::unique_ptr<VertexCoverSolver>(new VertexCoverSolver());
+    bool isBatch = false;
+    auto graphFiles = std::vector<std::string>();
+    GraphFormat format = GraphFormat::Commands;
+    bool isComplement = false;
+
+    // options:
+    //   --encoding=NAME   cardinality encoding of CNF-SAT-VC, see ParseCardinalityEncoding
+    //   --exact=NAME      exact method, see ParseExactMethod. branch-and-bound outputs BNB-VC in place of CNF-SAT-VC
+    //   --no-fast-path    solve every kernel component with the exact method, instead of a solver suiting its structure
+    //   --max-treewidth=N solve kernel components of treewidth at most N by tree decomposition, 16 by default
+    //   --batch           solve graphs in parallel while reading ahead, outputs stay in input order
+    //   --graph-file=PATH solve binary graph file written by graph-convert instead of reading input, may be repeated
+    //   --format=NAME     read input as a single graph of format, see ParseGraphFormat
+    //   --complement      solve the complement of the graph read with --format, for clique benchmarks
+    //   --cache-size=N    answer a graph with the same edges as one of the last N different graphs from cache, 0 to disable
+    //   --cover-cache=PATH keep CNF-SAT-VC covers in file PATH across runs, it may be shared by processes running at the same time
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        try {
+            if (option.compare(0, 11, "--encoding=") == 0) {
+                solver->SetCardinalityEncoding(ParseCardinalityEncoding(option.substr(11)));
+            } else if (option.compare(0, 8, "--exact=") == 0) {
+                solver->SetExactMethod(ParseExactMethod(option.substr(8)));
+            } else if (option == "--no-fast-path") {
+                solver->SetFastPaths(false);
+            } else if (option.compare(0, 16, "--max-treewidth=") == 0) {
+                solver->SetMaxTreewidth(getOptionInt("--max-treewidth", option.substr(16)));
+            } else if (option == "--batch") {
+                isBatch = true;
+            } else if (option.compare(0, 13, "--graph-file=") == 0) {
+                graphFiles.push_back(option.substr(13));
+            } else if (option.compare(0, 9, "--format=") == 0) {
+                format = ParseGraphFormat(option.substr(9));
+            } else if (option == "--complement") {
+                isComplement = true;
+            } else if (option.compare(0, 13, "--cache-size=") == 0) {
+                solver->SetResultCacheCapacity(getOptionInt("--cache-size", option.substr(13)));
+            } else if (option.compare(0, 14, "--cover-cache=") == 0) {
+                solver->SetCoverCacheFile(std::make_shared<CoverCacheFile>(option.substr(14)));
+            } else {
+                throw std::invalid_argument("unknown option " + option);
+            }
+        }
+        catch (std::exception &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+    if (isComplement && format == GraphFormat::Commands) {
+        std::cerr << "Error: --complement needs --format" << std::endl;
+        return 1;
+    }
+
+    // outputs are collected and written in large blocks
+    BufferedWriter writer(std::cout);
+
+    if (!graphFiles.empty()) {
+        // graph files are mapped and solved in order, without parsing
+        for (unsigned i = 0; i < graphFiles.size(); i++) {
+            try {
+                writer.Write(solver->AcceptGraphDeferred(OpenGraphFile(graphFiles[i], true))());
+            }
+            catch (std::runtime_error &e) {
+                writer.Write(std::string("Error: ") + e.what() + "\n");
+            }
+        }
+        return 0;
+    }
 
-    while (!std::cin.eof()) {
-        std::string line;
-        std::getline(std::cin, line);
+    if (format != GraphFormat::Commands) {
+        try {
+            GraphFormatReader formatReader(std::cin);
+            auto graph = formatReader.Read(format);
+            if (isComplement) {
+                graph = GraphFormatReader::GetComplement(*graph);
+            }
+            writer.Write(solver->AcceptGraphDeferred(graph)());
+        }
+        catch (std::invalid_argument &e) {
+            writer.Write(std::string("Error: ") + e.what() + "\n");
+        }
+        return 0;
+    }
+
+    // lines are read through a fixed buffer, so a huge E line is never held in memory as a whole
+    InputReader reader(std::cin);
 
+    if (isBatch) {
+        BatchSolver batchSolver(*solver, std::cout, std::thread::hardware_concurrency());
+        while (batchSolver.AcceptNextLine(reader)) {
+        }
+        batchSolver.Finish();
+        return 0;
+    }
+
+    while (true) {
+        // outputs so far are flushed before waiting for more input, so they are seen promptly when run interactively
+        if (!reader.HasBufferedLine()) {
+            writer.Flush();
+        }
         try {
-            auto result = solver->AcceptLine(line);
-            if (!result.empty()) {
-                std::cout << result;
+            std::function<std::string()> solve;
+            if (!reader.AcceptNextLine(*solver, solve)) {
+                break;
+            }
+            if (solve) {
+                writer.Write(solve());
             }
         }
         catch (std::invalid_argument &e) {
-            std::cout << "Error: " << e.what() << std::endl;
+            writer.Write(std::string("Error: ") + e.what() + "\n");
         }
     }
 
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "GraphFile.h"
+#include "GraphFormatReader.h"
+#include "VertexCoverSolver.h"
+
+// Convert graphs of V and E commands, or a single graph of another format, from input into binary graph files PREFIX-1.vcg, PREFIX-2.vcg, ...
+int main(int argc, char** argv) {
+    std::string prefix;
+    bool withChecksum = true;
+    GraphFormat format = GraphFormat::Commands;
+    bool isComplement = false;
+
+    // options:
+    //   --no-checksum     write files without checksum, so opening them skips hashing the arrays, they are still validated in full
+    //   --format=NAME     read input as a single graph of format, see ParseGraphFormat
+    //   --complement      write the complement of the graph read with --format
+    for (int i = 1; i < argc; i++) {
+        std::string option = argv[i];
+        if (option == "--no-checksum") {
+            withChecksum = false;
+        } else if (option.compare(0, 9, "--format=") == 0) {
+            try {
+                format = ParseGraphFormat(option.substr(9));
+            }
+            catch (std::invalid_argument &e) {
+                std::cerr << "Error: " << e.what() << std::endl;
+                return 1;
+            }
+        } else if (option == "--complement") {
+            isComplement = true;
+        } else if (option.compare(0, 2, "--") != 0 && prefix.empty()) {
+            prefix = option;
+        } else {
+            std::cerr << "Error: unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+    if (prefix.empty()) {
+        std::cerr << "Usage: graph-convert [--no-checksum] [--format=NAME [--complement]] PREFIX < INPUT" << std::endl;
+        return 1;
+    }
+
+    if (format != GraphFormat::Commands) {
+        try {
+            GraphFormatReader formatReader(std::cin);
+            auto graph = formatReader.Read(format);
+            if (isComplement) {
+                graph = GraphFormatReader::GetComplement(*graph);
+            }
+            std::string path = prefix + "-1.vcg";
+            WriteGraphFile(*graph, path, withChecksum);
+            std::cout << path << std::endl;
+        }
+        catch (std::exception &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    auto solver = std::unique_ptr<VertexCoverSolver>(new VertexCoverSolver());
+    int nGraph = 0;
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        try {
+            auto graph = solver->AcceptLineGraph(line);
+            if (graph) {
+                nGraph++;
+                std::string path = prefix + "-" + std::to_string(nGraph) + ".vcg";
+                WriteGraphFile(*graph, path, withChecksum);
+                std::cout << path << std::endl;
+            }
+        }
+        catch (std::invalid_argument &e) {
+            std::cout << "Error: " << e.what() << std::endl;
+        }
+        catch (std::runtime_error &e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
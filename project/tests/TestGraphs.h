@@ -0,0 +1,89 @@
+#ifndef TEST_GRAPHS_H
+#define TEST_GRAPHS_H
+
+#include <random>
+#include <vector>
+
+#include "../src/Graph.h"
+
+/*
+Graphs and reference covers shared by the tests of the exact solvers
+Random graphs take the generator, so every test draws its own sequence from its own seed
+*/
+
+// Minimal vertex cover by trying all subsets, for small graphs only
+inline std::vector<int> getMinimalVertexCoverByEnumeration(const Graph &graph) {
+    int nVertex = graph.GetVertexCount();
+    int bestMask = (1 << nVertex) - 1;
+    for (int mask = 0; mask < (1 << nVertex); mask++) {
+        if (__builtin_popcount(mask) >= __builtin_popcount(bestMask)) {
+            continue;
+        }
+        bool isCover = true;
+        for (int i = 1; i <= nVertex && isCover; i++) {
+            for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+                if (!(mask & (1 << (i - 1))) && !(mask & (1 << (*neighbor - 1)))) {
+                    isCover = false;
+                    break;
+                }
+            }
+        }
+        if (isCover) {
+            bestMask = mask;
+        }
+    }
+
+    auto result = std::vector<int>();
+    for (int i = 1; i <= nVertex; i++) {
+        if (bestMask & (1 << (i - 1))) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+// Graph of nEdge edges between random vertices, self loops and duplicates included
+inline Graph getRandomTestGraph(std::mt19937 &generator, int nVertex, int nEdge) {
+    std::uniform_int_distribution<int> vertexDistribution(1, nVertex);
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < nEdge; i++) {
+        edges.push_back(std::pair<int, int>(vertexDistribution(generator), vertexDistribution(generator)));
+    }
+    return Graph(nVertex, edges);
+}
+
+// Graph with every pair of vertices adjacent with probability density
+inline Graph getRandomDenseTestGraph(std::mt19937 &generator, int nVertex, double density) {
+    std::bernoulli_distribution edgeDistribution(density);
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= nVertex; i++) {
+        for (int j = i + 1; j <= nVertex; j++) {
+            if (edgeDistribution(generator)) {
+                edges.push_back(std::pair<int, int>(i, j));
+            }
+        }
+    }
+    return Graph(nVertex, edges);
+}
+
+// Graph with nLeft vertices on the left side, the rest on the right side, and random edges between the sides
+inline Graph getRandomBipartiteTestGraph(std::mt19937 &generator, int nLeft, int nRight, int nEdge) {
+    std::uniform_int_distribution<int> leftDistribution(1, nLeft);
+    std::uniform_int_distribution<int> rightDistribution(nLeft + 1, nLeft + nRight);
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < nEdge; i++) {
+        edges.push_back(std::pair<int, int>(leftDistribution(generator), rightDistribution(generator)));
+    }
+    return Graph(nLeft + nRight, edges);
+}
+
+// Random tree of nVertex vertices, every vertex but the first attached to an earlier one
+inline std::vector<std::pair<int, int>> getRandomTreeEdges(std::mt19937 &generator, int nVertex) {
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 2; i <= nVertex; i++) {
+        edges.push_back(std::pair<int, int>(std::uniform_int_distribution<int>(1, i - 1)(generator), i));
+    }
+    return edges;
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include <atomic>
+#include <sstream>
+#include <string>
+
+#include "doctest.h"
+#include "../src/BatchSolver.h"
+#include "../src/WorkStealingScheduler.h"
+
+TEST_CASE("WorkStealingScheduler_RunsNestedTasks") {
+    std::atomic<int> count(0);
+    WorkStealingScheduler scheduler(3);
+    for (int i = 0; i < 50; i++) {
+        scheduler.Submit([&]() {
+            count++;
+            // queued on the deque of this worker, other workers may steal it
+            scheduler.Submit([&]() {
+                count++;
+            });
+        });
+    }
+    scheduler.Wait();
+    REQUIRE_EQ(count.load(), 100);
+}
+
+TEST_CASE("BatchSolver_OutputInInputOrder") {
+    std::stringstream input;
+    std::stringstream expected;
+    for (int i = 0; i < 40; i++) {
+        // a path of i + 2 vertices needs (i + 2) / 2 vertices, and one graph has an invalid edge
+        input << "V " << i + 2 << std::endl;
+        if (i == 20) {
+            input << "E {<1,99>}" << std::endl;
+            continue;
+        }
+        input << "E {";
+        for (int j = 1; j < i + 2; j++) {
+            input << (j > 1 ? "," : "") << "<" << j << "," << j + 1 << ">";
+        }
+        input << "}" << std::endl;
+    }
+
+    VertexCoverSolver sequentialSolver = VertexCoverSolver();
+    std::stringstream output;
+    {
+        VertexCoverSolver solver = VertexCoverSolver();
+        BatchSolver batchSolver(solver, output, 4);
+        std::string line;
+        while (std::getline(input, line)) {
+            batchSolver.AcceptLine(line);
+            try {
+                expected << sequentialSolver.AcceptLine(line);
+            }
+            catch (std::invalid_argument &e) {
+                expected << "Error: " << e.what() << std::endl;
+            }
+        }
+        batchSolver.Finish();
+    }
+
+    // APPROX-VC-2 picks random edges, so only the CNF-SAT-VC and error lines are compared
+    std::string outputLine, expectedLine;
+    int nLine = 0;
+    while (std::getline(expected, expectedLine)) {
+        REQUIRE(std::getline(output, outputLine));
+        if (expectedLine.compare(0, 13, "APPROX-VC-2: ") != 0) {
+            REQUIRE_EQ(outputLine, expectedLine);
+        }
+        nLine++;
+    }
+    REQUIRE_FALSE(std::getline(output, outputLine));
+    REQUIRE_EQ(nLine, 39 * 3 + 1);
+}
@@ -0,0 +1,59 @@
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/BipartiteSolver.h"
+
+TEST_CASE("BipartiteSolver_CompleteBipartite") {
+    // the smaller side of K(3,5) is the only minimal cover
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= 3; i++) {
+        for (int j = 4; j <= 8; j++) {
+            edges.push_back(std::pair<int, int>(j, i));
+        }
+    }
+    Graph graph = Graph(8, edges);
+    BipartiteSolver solver(graph);
+    REQUIRE_EQ(solver.Solve(), std::vector<int>({1, 2, 3}));
+    REQUIRE_EQ(solver.GetMatchingSize(), 3);
+}
+
+TEST_CASE("BipartiteSolver_IsBipartite") {
+    // an even cycle is bipartite, an odd cycle and a self loop are not
+    Graph evenCycle = Graph(4, std::vector<std::pair<int, int>>({
+        std::pair<int, int>(1, 2), std::pair<int, int>(2, 3), std::pair<int, int>(3, 4), std::pair<int, int>(4, 1)}));
+    REQUIRE(BipartiteSolver(evenCycle).IsBipartite());
+
+    Graph oddCycle = Graph(5, std::vector<std::pair<int, int>>({
+        std::pair<int, int>(1, 2), std::pair<int, int>(2, 3), std::pair<int, int>(3, 4), std::pair<int, int>(4, 5), std::pair<int, int>(5, 1)}));
+    BipartiteSolver oddCycleSolver(oddCycle);
+    REQUIRE_FALSE(oddCycleSolver.IsBipartite());
+    REQUIRE_THROWS_AS(oddCycleSolver.Solve(), std::invalid_argument);
+
+    Graph selfLoop = Graph(3, std::vector<std::pair<int, int>>({std::pair<int, int>(1, 2), std::pair<int, int>(3, 3)}));
+    REQUIRE_FALSE(BipartiteSolver(selfLoop).IsBipartite());
+
+    Graph noEdges = Graph(3, std::vector<std::pair<int, int>>());
+    BipartiteSolver noEdgesSolver(noEdges);
+    REQUIRE(noEdgesSolver.IsBipartite());
+    REQUIRE(noEdgesSolver.Solve().empty());
+}
+
+TEST_CASE("BipartiteSolver_LongPath") {
+    // left vertices are numbered backwards along the path and right vertices forwards, so the greedy matching
+    // leaves both ends free, and the augmenting path between them, as long as the graph, must not overflow the stack
+    int nVertex = 200000;
+    auto pathVertices = std::vector<int>();
+    for (int i = 0; i < nVertex; i++) {
+        pathVertices.push_back(i % 2 == 0 ? nVertex / 2 - i / 2 : nVertex / 2 + (i + 1) / 2);
+    }
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 0; i + 1 < nVertex; i++) {
+        edges.push_back(std::pair<int, int>(pathVertices[i], pathVertices[i + 1]));
+    }
+    Graph graph = Graph(nVertex, edges);
+    BipartiteSolver solver(graph);
+    auto result = solver.Solve();
+    REQUIRE(graph.IsVertexCover(result));
+    REQUIRE_EQ(result.size(), nVertex / 2);
+}
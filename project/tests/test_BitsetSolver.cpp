@@ -0,0 +1,28 @@
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+#include "TestGraphs.h"
+#include "../src/BitsetSolver.h"
+#include "../src/BranchAndBoundSolver.h"
+
+TEST_CASE("BitsetSolver_SameSizeAsBranchAndBoundOnEveryWidth") {
+    // vertex counts around the boundaries of 64, 128 and 256 bits
+    std::mt19937 generator(0);
+    for (int nVertex : {63, 64, 65, 127, 128, 129, 255, 256}) {
+        Graph graph = getRandomTestGraph(generator, nVertex, nVertex * 3 / 2);
+
+        BitsetSolver solver(graph);
+        auto result = solver.Solve(std::vector<int>());
+        REQUIRE(graph.IsVertexCover(result));
+        BranchAndBoundSolver reference(graph);
+        REQUIRE_EQ(result.size(), reference.Solve(std::vector<int>()).size());
+    }
+}
+
+TEST_CASE("BitsetSolver_TooLarge") {
+    Graph graph = Graph(BitsetSolver::maxVertexCount + 1, std::vector<std::pair<int, int>>({std::pair<int, int>(1, 2)}));
+    REQUIRE_FALSE(BitsetSolver::CanSolve(graph));
+    REQUIRE_THROWS_AS(BitsetSolver solver(graph), std::invalid_argument);
+}
@@ -0,0 +1,14 @@
+#include <stdexcept>
+#include <string>
+
+#include "doctest.h"
+#include "../src/VertexCoverSolver.h"
+
+TEST_CASE("VertexCoverSolver_BranchAndBound") {
+    VertexCoverSolver solver = VertexCoverSolver();
+    solver.SetExactMethod(ParseExactMethod("branch-and-bound"));
+    solver.AcceptLine("V 5");
+    std::string output = solver.AcceptLine("E {<3,2>,<3,1>,<3,4>,<4,5>,<5,2>}");
+    REQUIRE_EQ(output.substr(0, output.find('\n')), "BNB-VC: 3,5");
+    REQUIRE_THROWS_AS(ParseExactMethod("dfs"), std::invalid_argument);
+}
@@ -0,0 +1,41 @@
+#include <memory>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/CancellationToken.h"
+#include "../src/Graph.h"
+
+TEST_CASE("CancellationToken_AttachAfterCancel") {
+    CancellationToken token;
+    REQUIRE_FALSE(token.IsCancelled());
+    token.Cancel();
+    REQUIRE(token.IsCancelled());
+    REQUIRE_THROWS_AS(token.ThrowIfCancelled(), OperationCancelled);
+
+    // a solver attached after cancellation is interrupted right away
+    Minisat::Solver solver;
+    Minisat::Lit a = Minisat::mkLit(solver.newVar());
+    Minisat::Lit b = Minisat::mkLit(solver.newVar());
+    solver.addClause(a, b);
+    token.AttachSolver(&solver);
+    Minisat::vec<Minisat::Lit> assumptions;
+    REQUIRE_EQ(Minisat::toInt(solver.solveLimited(assumptions)), Minisat::toInt(Minisat::l_Undef));
+    token.DetachSolver(&solver);
+}
+
+TEST_CASE("Graph_CNF_SAT_Cancelled") {
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= 6; i++) {
+        for (int j = i + 1; j <= 6; j++) {
+            edges.push_back(std::pair<int, int>(i, j));
+        }
+    }
+
+    Graph graph = Graph(6, edges);
+    auto token = std::make_shared<CancellationToken>();
+    graph.SetCancellationToken(token);
+    REQUIRE_EQ(graph.GetMinimalVertexCover_CNF_SAT().size(), 5);
+
+    token->Cancel();
+    REQUIRE_THROWS_AS(graph.GetMinimalVertexCover_CNF_SAT(), OperationCancelled);
+}
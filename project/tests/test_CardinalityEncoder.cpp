@@ -0,0 +1,77 @@
+#include <memory>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/CardinalityEncoder.h"
+
+// For every assignment of nInputs inputs and every bound in [0, maxBound], "at most bound" should be satisfiable exactly when the count is not larger
+void validateAtMost(CardinalityEncoding encoding, int nInputs, int maxBound) {
+    Minisat::Solver solver;
+    auto inputs = std::vector<Minisat::Lit>();
+    for (int i = 0; i < nInputs; i++) {
+        inputs.push_back(Minisat::mkLit(solver.newVar()));
+    }
+
+    auto encoder = CardinalityEncoder::Create(encoding, nInputs, maxBound);
+    encoder->Encode(solver, inputs, maxBound);
+
+    for (int bound = 0; bound <= maxBound; bound++) {
+        for (int mask = 0; mask < (1 << nInputs); mask++) {
+            Minisat::vec<Minisat::Lit> assumptions;
+            int count = 0;
+            for (int i = 0; i < nInputs; i++) {
+                if (mask & (1 << i)) {
+                    assumptions.push(inputs[i]);
+                    count++;
+                } else {
+                    assumptions.push(~inputs[i]);
+                }
+            }
+            encoder->AppendAtMostAssumptions(solver, bound, assumptions);
+            REQUIRE_EQ(solver.solve(assumptions), count <= bound);
+        }
+    }
+}
+
+TEST_CASE("CardinalityEncoder_Totalizer") {
+    validateAtMost(CardinalityEncoding::Totalizer, 1, 0);
+    validateAtMost(CardinalityEncoding::Totalizer, 7, 6);
+}
+
+TEST_CASE("CardinalityEncoder_TruncatedTotalizer") {
+    validateAtMost(CardinalityEncoding::TruncatedTotalizer, 1, 0);
+    validateAtMost(CardinalityEncoding::TruncatedTotalizer, 7, 3);
+    validateAtMost(CardinalityEncoding::TruncatedTotalizer, 7, 6);
+}
+
+TEST_CASE("CardinalityEncoder_SequentialCounter") {
+    validateAtMost(CardinalityEncoding::SequentialCounter, 1, 0);
+    validateAtMost(CardinalityEncoding::SequentialCounter, 7, 2);
+    validateAtMost(CardinalityEncoding::SequentialCounter, 7, 6);
+}
+
+TEST_CASE("CardinalityEncoder_CardinalityNetwork") {
+    validateAtMost(CardinalityEncoding::CardinalityNetwork, 1, 0);
+    validateAtMost(CardinalityEncoding::CardinalityNetwork, 7, 3);
+    validateAtMost(CardinalityEncoding::CardinalityNetwork, 8, 7);
+}
+
+TEST_CASE("CardinalityEncoder_ModuloTotalizer") {
+    validateAtMost(CardinalityEncoding::ModuloTotalizer, 1, 0);
+    validateAtMost(CardinalityEncoding::ModuloTotalizer, 7, 3);
+    validateAtMost(CardinalityEncoding::ModuloTotalizer, 9, 8);
+}
+
+TEST_CASE("CardinalityEncoder_ResolveAuto") {
+    REQUIRE(CardinalityEncoder::Resolve(CardinalityEncoding::Auto, 100, 1) == CardinalityEncoding::SequentialCounter);
+    REQUIRE(CardinalityEncoder::Resolve(CardinalityEncoding::Auto, 100, 50) == CardinalityEncoding::TruncatedTotalizer);
+    REQUIRE(CardinalityEncoder::Resolve(CardinalityEncoding::Auto, 10000, 9000) == CardinalityEncoding::CardinalityNetwork);
+    REQUIRE(CardinalityEncoder::Resolve(CardinalityEncoding::Auto, 10000, 1000) == CardinalityEncoding::ModuloTotalizer);
+    REQUIRE(CardinalityEncoder::Resolve(CardinalityEncoding::Totalizer, 10000, 1) == CardinalityEncoding::Totalizer);
+}
+
+TEST_CASE("ParseCardinalityEncoding_Names") {
+    REQUIRE(ParseCardinalityEncoding("auto") == CardinalityEncoding::Auto);
+    REQUIRE(ParseCardinalityEncoding("modulo-totalizer") == CardinalityEncoding::ModuloTotalizer);
+    REQUIRE_THROWS(ParseCardinalityEncoding("unknown"));
+}
@@ -0,0 +1,32 @@
+#include <random>
+#include <vector>
+
+#include "doctest.h"
+#include "TestGraphs.h"
+#include "../src/BranchAndBoundSolver.h"
+#include "../src/CliqueSolver.h"
+
+TEST_CASE("CliqueSolver_SameSizeAsBranchAndBound") {
+    // vertex counts across several words of a candidate set
+    std::mt19937 generator(0);
+    for (int nVertex : {63, 64, 65, 130, 200}) {
+        Graph graph = getRandomDenseTestGraph(generator, nVertex, 0.9);
+
+        CliqueSolver solver(graph);
+        auto result = solver.Solve(std::vector<int>());
+        REQUIRE(graph.IsVertexCover(result));
+        BranchAndBoundSolver reference(graph);
+        REQUIRE_EQ(result.size(), reference.Solve(std::vector<int>()).size());
+    }
+}
+
+TEST_CASE("CliqueSolver_IsDense") {
+    std::mt19937 generator(1);
+    REQUIRE(CliqueSolver::IsDense(getRandomDenseTestGraph(generator, 50, 1.0)));
+    REQUIRE(CliqueSolver::IsDense(getRandomDenseTestGraph(generator, 50, 0.9)));
+    REQUIRE_FALSE(CliqueSolver::IsDense(getRandomDenseTestGraph(generator, 50, 0.02)));
+
+    // self loops are not counted as edges
+    Graph loops = Graph(2, std::vector<std::pair<int, int>>({std::pair<int, int>(1, 1), std::pair<int, int>(2, 2)}));
+    REQUIRE_FALSE(CliqueSolver::IsDense(loops));
+}
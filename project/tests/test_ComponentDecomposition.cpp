@@ -0,0 +1,65 @@
+#include <vector>
+
+#include "doctest.h"
+#include "../src/ComponentDecomposition.h"
+
+TEST_CASE("ComponentDecomposition_CountComponents") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(5, 6),
+        std::pair<int, int>(7, 7)
+    };
+
+    Graph graph = Graph(8, edges);
+    REQUIRE_EQ(ComponentDecomposition::CountComponents(graph), 3);
+
+    ComponentDecomposition decomposition(graph);
+    REQUIRE_EQ(decomposition.GetComponentCount(), 3);
+    // largest component first
+    REQUIRE_EQ(decomposition.GetComponent(0).GetVertexCount(), 3);
+}
+
+TEST_CASE("ComponentDecomposition_MergeCoversInOriginalIndices") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(4, 6),
+        std::pair<int, int>(6, 8),
+        std::pair<int, int>(1, 3)
+    };
+
+    Graph graph = Graph(8, edges);
+    ComponentDecomposition decomposition(graph);
+    REQUIRE_EQ(decomposition.GetComponentCount(), 2);
+
+    auto componentCovers = std::vector<std::vector<int>>(2);
+    for (int i = 0; i < 2; i++) {
+        decomposition.GetComponent(i).getVertexCoverWithAPPROX_VC_1(componentCovers[i]);
+    }
+    auto result = decomposition.MergeCovers(componentCovers);
+    REQUIRE_EQ(result.size(), 2);
+    REQUIRE((result[0] == 1 || result[0] == 3));
+    REQUIRE_EQ(result[1], 6);
+}
+
+TEST_CASE("Graph_CNF_SAT_DisconnectedComponents") {
+    auto edges = std::vector<std::pair<int, int>>();
+    // four disjoint 4-cliques, each needs 3 vertices
+    for (int c = 0; c < 4; c++) {
+        for (int i = 1; i <= 4; i++) {
+            for (int j = i + 1; j <= 4; j++) {
+                edges.push_back(std::pair<int, int>(c * 4 + i, c * 4 + j));
+            }
+        }
+    }
+
+    Graph graph = Graph(16, edges);
+    auto result = graph.GetMinimalVertexCover_CNF_SAT();
+    REQUIRE_EQ(result.size(), 12);
+    for (unsigned i = 1; i < result.size(); i++) {
+        REQUIRE(result[i - 1] < result[i]);
+    }
+
+    auto resultWithApprox = std::vector<int>();
+    graph.getVertexCoverWithAPPROX_VC_2(resultWithApprox);
+    REQUIRE_EQ(resultWithApprox.size(), 16);
+}
@@ -0,0 +1,129 @@
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/CoverCacheFile.h"
+#include "../src/VertexCoverSolver.h"
+
+std::string getCoverCacheFilePath() {
+    return "/tmp/test_CoverCacheFile_" + std::to_string(getpid()) + ".cache";
+}
+
+GraphFingerprint getPathFingerprint(int nVertex) {
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i < nVertex; i++) {
+        edges.push_back(std::pair<int, int>(i, i + 1));
+    }
+    return GetGraphFingerprint(Graph(nVertex, edges));
+}
+
+TEST_CASE("CoverCacheFile_SharedByInstances") {
+    std::string path = getCoverCacheFilePath();
+    std::remove(path.c_str());
+
+    // two instances stand for two processes sharing the file
+    CoverCacheFile writer(path);
+    CoverCacheFile reader(path);
+    std::vector<int> cover;
+    REQUIRE_FALSE(reader.Find(getPathFingerprint(3), cover));
+
+    writer.Insert(getPathFingerprint(3), std::vector<int>(1, 2));
+    writer.Insert(getPathFingerprint(4), std::vector<int>({1, 3}));
+    REQUIRE(reader.Find(getPathFingerprint(3), cover));
+    REQUIRE_EQ(cover, std::vector<int>(1, 2));
+    REQUIRE(reader.Find(getPathFingerprint(4), cover));
+    REQUIRE_EQ(cover, std::vector<int>({1, 3}));
+    REQUIRE_EQ(reader.GetCount(), 2);
+
+    // kept after reopening
+    CoverCacheFile reopened(path);
+    REQUIRE_EQ(reopened.GetCount(), 2);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("CoverCacheFile_CutTornRecord") {
+    std::string path = getCoverCacheFilePath();
+    std::remove(path.c_str());
+    {
+        CoverCacheFile file(path);
+        file.Insert(getPathFingerprint(3), std::vector<int>(1, 2));
+    }
+    {
+        // a record cut short by a process dying while writing it
+        std::ofstream stream(path, std::ios::binary | std::ios::app);
+        stream.write("\x01\x02\x03\x04\x05\x06\x07", 7);
+    }
+
+    CoverCacheFile file(path);
+    REQUIRE_EQ(file.GetCount(), 1);
+    file.Insert(getPathFingerprint(4), std::vector<int>({1, 3}));
+
+    CoverCacheFile reopened(path);
+    std::vector<int> cover;
+    REQUIRE_EQ(reopened.GetCount(), 2);
+    REQUIRE(reopened.Find(getPathFingerprint(4), cover));
+    REQUIRE_EQ(cover, std::vector<int>({1, 3}));
+    std::remove(path.c_str());
+}
+
+TEST_CASE("CoverCacheFile_RejectOtherFile") {
+    std::string path = getCoverCacheFilePath();
+    {
+        std::ofstream stream(path, std::ios::trunc);
+        stream << "V 3" << std::endl << "E {<1,2>,<2,3>}" << std::endl;
+    }
+    REQUIRE_THROWS_AS(CoverCacheFile file(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("VertexCoverSolver_CNF_SAT_FromCoverCacheFile") {
+    std::string path = getCoverCacheFilePath();
+    std::remove(path.c_str());
+    auto file = std::make_shared<CoverCacheFile>(path);
+    // another minimum cover than the one solved, so it is only output if it is taken from the file
+    file->Insert(getPathFingerprint(3), std::vector<int>(1, 2));
+    file->Insert(getPathFingerprint(4), std::vector<int>({1, 3}));
+
+    VertexCoverSolver solver = VertexCoverSolver();
+    solver.SetCoverCacheFile(file);
+    solver.SetResultCacheCapacity(0);
+    solver.AcceptLine("V 4");
+    std::string output = solver.AcceptLine("E {<1,2>,<2,3>,<3,4>}");
+    REQUIRE_EQ(output.substr(0, output.find('\n')), "CNF-SAT-VC: 1,3");
+
+    // solved and stored
+    solver.AcceptLine("V 5");
+    output = solver.AcceptLine("E {<1,2>,<2,3>,<3,4>,<4,5>}");
+    REQUIRE_EQ(output.substr(0, output.find('\n')), "CNF-SAT-VC: 2,4");
+    std::vector<int> cover;
+    REQUIRE(CoverCacheFile(path).Find(getPathFingerprint(5), cover));
+    REQUIRE_EQ(cover, std::vector<int>({2, 4}));
+    std::remove(path.c_str());
+}
+
+TEST_CASE("VertexCoverSolver_CNF_SAT_RejectCoverCacheRecord") {
+    std::string path = getCoverCacheFilePath();
+    std::remove(path.c_str());
+    auto file = std::make_shared<CoverCacheFile>(path);
+    // larger than the approximations, not in ascending order, and with a duplicate
+    file->Insert(getPathFingerprint(4), std::vector<int>({1, 2, 3}));
+    file->Insert(getPathFingerprint(5), std::vector<int>({4, 2}));
+    file->Insert(getPathFingerprint(6), std::vector<int>({2, 2, 4, 5}));
+
+    VertexCoverSolver solver = VertexCoverSolver();
+    solver.SetCoverCacheFile(file);
+    solver.AcceptLine("V 4");
+    std::string output = solver.AcceptLine("E {<1,2>,<2,3>,<3,4>}");
+    REQUIRE_EQ(output.substr(0, output.find('\n')), "CNF-SAT-VC: 2,4");
+    solver.AcceptLine("V 5");
+    output = solver.AcceptLine("E {<1,2>,<2,3>,<3,4>,<4,5>}");
+    REQUIRE_EQ(output.substr(0, output.find('\n')), "CNF-SAT-VC: 2,4");
+    solver.AcceptLine("V 6");
+    output = solver.AcceptLine("E {<1,2>,<2,3>,<3,4>,<4,5>,<5,6>}");
+    REQUIRE_EQ(output.substr(0, output.find('\n')), "CNF-SAT-VC: 2,4,6");
+    std::remove(path.c_str());
+}
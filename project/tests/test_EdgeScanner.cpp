@@ -0,0 +1,74 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/EdgeScanner.h"
+
+// Levels supported by the running CPU, always including Scalar
+std::vector<SimdLevel> getSupportedLevels() {
+    auto levels = std::vector<SimdLevel>(1, SimdLevel::Scalar);
+    if (GetSupportedSimdLevel() != SimdLevel::Scalar) {
+        levels.push_back(SimdLevel::SSE42);
+    }
+    if (GetSupportedSimdLevel() == SimdLevel::AVX2) {
+        levels.push_back(SimdLevel::AVX2);
+    }
+    return levels;
+}
+
+bool scanEdges(SimdLevel level, const std::string &edges, int nVertex, std::vector<std::pair<int, int>> &result) {
+    result.clear();
+    return ScanEdges(level, edges.data(), edges.data() + edges.size(), nVertex, result);
+}
+
+TEST_CASE("ScanEdges_WellFormed") {
+    // long enough to span several blocks, with indices of every digit count
+    std::mt19937 generator(650);
+    auto expected = std::vector<std::pair<int, int>>();
+    std::string edges;
+    for (int i = 0; i < 500; i++) {
+        int digitCount = 1 + i % 10;
+        int first = std::uniform_int_distribution<int>(1, 9)(generator);
+        int second = std::uniform_int_distribution<int>(1, 2000000000)(generator);
+        for (int j = 1; j < digitCount && first < 200000000; j++) {
+            first = first * 10 + std::uniform_int_distribution<int>(0, 9)(generator);
+        }
+        expected.push_back(std::pair<int, int>(first, second));
+        edges += (i > 0 ? ",<" : "<") + std::to_string(first) + "," + std::to_string(second) + ">";
+    }
+
+    auto levels = getSupportedLevels();
+    for (unsigned i = 1; i < levels.size(); i++) {
+        auto result = std::vector<std::pair<int, int>>();
+        REQUIRE(scanEdges(levels[i], edges, 2147483647, result));
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE("ScanEdges_RejectInvalid") {
+    std::vector<std::string> invalidEdges = {
+        "<1,2>,",
+        "<1,2><2,3>",
+        "<1,2>,<2,3",
+        "<01,2>",
+        "<0,2>",
+        "<1,16>",
+        "<1,2147483648>",
+        "<1,99999999999>",
+        "<1,,2>",
+        "<,2>",
+        "<1,2,3>",
+        "<1>,2>",
+        " <1,2>",
+        "<1,2>x"
+    };
+
+    auto levels = getSupportedLevels();
+    for (unsigned i = 0; i < levels.size(); i++) {
+        for (unsigned j = 0; j < invalidEdges.size(); j++) {
+            auto result = std::vector<std::pair<int, int>>();
+            REQUIRE_FALSE(scanEdges(levels[i], invalidEdges[j], 15, result));
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "TestGraphs.h"
+#include "../src/BipartiteSolver.h"
+#include "../src/BitsetSolver.h"
+#include "../src/BranchAndBoundSolver.h"
+#include "../src/CliqueSolver.h"
+#include "../src/ForestSolver.h"
+#include "../src/TreeDecompositionSolver.h"
+
+// Graph of one of the structures the exact solvers specialise in, chosen by round: sparse, dense, bipartite or a forest
+Graph getExactSolverTestGraph(std::mt19937 &generator, int round, int nVertex) {
+    switch (round % 4) {
+    case 0:
+        return getRandomTestGraph(generator, nVertex, std::uniform_int_distribution<int>(0, nVertex * 3)(generator));
+    case 1:
+        return getRandomDenseTestGraph(generator, nVertex, 0.2 + 0.1 * (round / 4 % 8));
+    case 2: {
+        int nLeft = std::uniform_int_distribution<int>(1, nVertex - 1)(generator);
+        int nEdge = std::uniform_int_distribution<int>(0, nLeft * (nVertex - nLeft))(generator);
+        return getRandomBipartiteTestGraph(generator, nLeft, nVertex - nLeft, nEdge);
+    }
+    default: {
+        // dropping edges of a tree leaves a forest
+        auto edges = getRandomTreeEdges(generator, nVertex);
+        int nDropped = std::uniform_int_distribution<int>(0, nVertex / 2)(generator);
+        edges.erase(edges.begin(), edges.begin() + nDropped);
+        return Graph(nVertex, edges);
+    }
+    }
+}
+
+// Cover of graph by every exact solver suiting it, and by Graph with and without fast paths, each labelled with its solver
+std::vector<std::pair<std::string, std::vector<int>>> getCoversOfExactSolvers(Graph &graph, const std::vector<int> &knownCover) {
+    auto covers = std::vector<std::pair<std::string, std::vector<int>>>();
+
+    BranchAndBoundSolver branchAndBoundSolver(graph);
+    covers.push_back(std::make_pair("BranchAndBoundSolver", branchAndBoundSolver.Solve(knownCover)));
+    if (BitsetSolver::CanSolve(graph)) {
+        BitsetSolver bitsetSolver(graph);
+        covers.push_back(std::make_pair("BitsetSolver", bitsetSolver.Solve(knownCover)));
+    }
+    CliqueSolver cliqueSolver(graph);
+    covers.push_back(std::make_pair("CliqueSolver", cliqueSolver.Solve(knownCover)));
+    TreeDecompositionSolver decompositionSolver(graph, TreeDecompositionSolver::defaultMaxWidth);
+    if (decompositionSolver.IsDecomposed()) {
+        covers.push_back(std::make_pair("TreeDecompositionSolver", decompositionSolver.Solve()));
+    }
+    BipartiteSolver bipartiteSolver(graph);
+    if (bipartiteSolver.IsBipartite()) {
+        covers.push_back(std::make_pair("BipartiteSolver", bipartiteSolver.Solve()));
+    }
+    if (ForestSolver::IsForest(graph)) {
+        ForestSolver forestSolver(graph);
+        covers.push_back(std::make_pair("ForestSolver", forestSolver.Solve()));
+    }
+
+    graph.SetFastPaths(false);
+    covers.push_back(std::make_pair("Graph CNF-SAT", graph.GetMinimalVertexCover_CNF_SAT(knownCover)));
+    graph.SetFastPaths(true);
+    covers.push_back(std::make_pair("Graph CNF-SAT with fast paths", graph.GetMinimalVertexCover_CNF_SAT(knownCover)));
+    covers.push_back(std::make_pair("Graph branch and bound with fast paths", graph.GetMinimalVertexCover_BranchAndBound(knownCover)));
+    return covers;
+}
+
+// Require every cover to be a cover of graph of expectedSize vertices, a failure names the solver
+void validateCoversOfExactSolvers(const Graph &graph, const std::vector<std::pair<std::string, std::vector<int>>> &covers, size_t expectedSize) {
+    for (auto &cover : covers) {
+        REQUIRE_EQ(cover.first + (graph.IsVertexCover(cover.second) ? " covers" : " does not cover"), cover.first + " covers");
+        REQUIRE_EQ(cover.first + " " + std::to_string(cover.second.size()), cover.first + " " + std::to_string(expectedSize));
+    }
+}
+
+// Run solve on this thread while another thread cancels token after a while, and require solve to stop with OperationCancelled
+template <typename Solve>
+void requireCancelledDuringSolve(const std::shared_ptr<CancellationToken> &token, Solve solve) {
+    std::thread canceller([&token]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        token->Cancel();
+    });
+    bool isCancelled = false;
+    try {
+        solve();
+    }
+    catch (const OperationCancelled &) {
+        isCancelled = true;
+    }
+    canceller.join();
+    REQUIRE(isCancelled);
+}
+
+TEST_CASE("ExactSolvers_SameSizeAsEnumeration") {
+    std::mt19937 generator(650);
+    for (int round = 0; round < 200; round++) {
+        Graph graph = getExactSolverTestGraph(generator, round, 2 + round % 15);
+        auto covers = getCoversOfExactSolvers(graph, std::vector<int>());
+        validateCoversOfExactSolvers(graph, covers, getMinimalVertexCoverByEnumeration(graph).size());
+    }
+}
+
+TEST_CASE("ExactSolvers_SameSizeOnLargerGraphs") {
+    // too large to enumerate, so the solvers are compared with each other
+    std::mt19937 generator(0);
+    for (int round = 0; round < 40; round++) {
+        Graph graph = getExactSolverTestGraph(generator, round, 60);
+        auto covers = getCoversOfExactSolvers(graph, std::vector<int>());
+        validateCoversOfExactSolvers(graph, covers, covers[0].second.size());
+    }
+}
+
+TEST_CASE("ExactSolvers_KnownCoverIsOptimal") {
+    // a 5-cycle needs 3 vertices, so the known cover is returned as is by the solvers starting from it
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 4),
+        std::pair<int, int>(4, 5),
+        std::pair<int, int>(5, 1)
+    };
+    Graph graph = Graph(5, edges);
+    std::vector<int> knownCover = {4, 2, 5};
+    BranchAndBoundSolver branchAndBoundSolver(graph);
+    REQUIRE_EQ(branchAndBoundSolver.Solve(knownCover), std::vector<int>({2, 4, 5}));
+    BitsetSolver bitsetSolver(graph);
+    REQUIRE_EQ(bitsetSolver.Solve(knownCover), std::vector<int>({2, 4, 5}));
+    CliqueSolver cliqueSolver(graph);
+    REQUIRE_EQ(cliqueSolver.Solve(knownCover), std::vector<int>({2, 4, 5}));
+}
+
+TEST_CASE("ExactSolvers_SelfLoopTaken") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 1),
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(3, 3)
+    };
+    Graph graph = Graph(3, edges);
+    for (auto &cover : getCoversOfExactSolvers(graph, std::vector<int>())) {
+        REQUIRE_EQ(cover.second, std::vector<int>({1, 3}));
+    }
+}
+
+TEST_CASE("ExactSolvers_CancelledDuringSearch") {
+    // each graph takes seconds to solve, far longer than the cancellation comes after
+    std::mt19937 generator(0);
+    Graph sparse = getRandomTestGraph(generator, 200, 3000);
+    Graph dense = getRandomDenseTestGraph(generator, 300, 0.1);
+
+    auto branchAndBoundToken = std::make_shared<CancellationToken>();
+    BranchAndBoundSolver branchAndBoundSolver(sparse);
+    branchAndBoundSolver.SetCancellationToken(branchAndBoundToken);
+    requireCancelledDuringSolve(branchAndBoundToken, [&branchAndBoundSolver]() {
+        branchAndBoundSolver.Solve(std::vector<int>());
+    });
+    REQUIRE_GT(branchAndBoundSolver.GetNodeCount(), 0);
+
+    auto bitsetToken = std::make_shared<CancellationToken>();
+    BitsetSolver bitsetSolver(sparse);
+    bitsetSolver.SetCancellationToken(bitsetToken);
+    requireCancelledDuringSolve(bitsetToken, [&bitsetSolver]() {
+        bitsetSolver.Solve(std::vector<int>());
+    });
+
+    auto cliqueToken = std::make_shared<CancellationToken>();
+    CliqueSolver cliqueSolver(dense);
+    cliqueSolver.SetCancellationToken(cliqueToken);
+    requireCancelledDuringSolve(cliqueToken, [&cliqueSolver]() {
+        cliqueSolver.Solve(std::vector<int>());
+    });
+    REQUIRE_GT(cliqueSolver.GetNodeCount(), 0);
+}
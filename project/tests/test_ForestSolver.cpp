@@ -0,0 +1,47 @@
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+#include "TestGraphs.h"
+#include "../src/ForestSolver.h"
+
+TEST_CASE("ForestSolver_IsForest") {
+    Graph cycle = Graph(3, std::vector<std::pair<int, int>>({
+        std::pair<int, int>(1, 2), std::pair<int, int>(2, 3), std::pair<int, int>(3, 1)}));
+    REQUIRE_FALSE(ForestSolver::IsForest(cycle));
+    ForestSolver cycleSolver(cycle);
+    REQUIRE_THROWS_AS(cycleSolver.Solve(), std::invalid_argument);
+
+    Graph selfLoop = Graph(2, std::vector<std::pair<int, int>>({std::pair<int, int>(1, 2), std::pair<int, int>(2, 2)}));
+    REQUIRE_FALSE(ForestSolver::IsForest(selfLoop));
+
+    Graph star = Graph(5, std::vector<std::pair<int, int>>({
+        std::pair<int, int>(3, 1), std::pair<int, int>(3, 2), std::pair<int, int>(3, 4), std::pair<int, int>(3, 5)}));
+    REQUIRE(ForestSolver::IsForest(star));
+    ForestSolver starSolver(star);
+    REQUIRE_EQ(starSolver.Solve(), std::vector<int>({3}));
+}
+
+TEST_CASE("ForestSolver_LongPath") {
+    // a tree as deep as the graph, which must not overflow the stack
+    int nVertex = 200000;
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i < nVertex; i++) {
+        edges.push_back(std::pair<int, int>(i, i + 1));
+    }
+    Graph graph = Graph(nVertex, edges);
+    ForestSolver solver(graph);
+    auto result = solver.Solve();
+    REQUIRE(graph.IsVertexCover(result));
+    REQUIRE_EQ(result.size(), nVertex / 2);
+}
+
+TEST_CASE("Graph_FastPathsForest") {
+    // a forest is solved before the kernel
+    std::mt19937 generator(1);
+    Graph tree = Graph(1000, getRandomTreeEdges(generator, 1000));
+    tree.SetFastPaths(true);
+    ForestSolver forestSolver(tree);
+    REQUIRE_EQ(tree.GetMinimalVertexCover_CNF_SAT(std::vector<int>()), forestSolver.Solve());
+}
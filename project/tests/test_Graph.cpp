@@ -1,7 +1,10 @@
+#include <algorithm>
+#include <random>
 #include <vector>
 #include <set>
 
 #include "doctest.h"
+#include "TestGraphs.h"
 #include "../src/Graph.h"
 
 void validateVertexCoverResult_CNF_SAT(const std::vector<int> result, int nExpectedSize, const std::vector<std::pair<int, int>> edgesToCover) {
@@ -221,6 +224,104 @@ TEST_CASE("GetMinimalVertexCover_CNF_SAT_ComplexExample") {
     validateVertexCoverResult_CNF_SAT(result, 8, edges);
 }
 
+TEST_CASE("GetMinimalVertexCover_CNF_SAT_AllEncodings") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(21, 4),
+        std::pair<int, int>(4, 2),
+        std::pair<int, int>(2, 1),
+        std::pair<int, int>(1, 3),
+        std::pair<int, int>(3, 20),
+        std::pair<int, int>(23, 14),
+        std::pair<int, int>(14, 1),
+        std::pair<int, int>(1, 5),
+        std::pair<int, int>(5, 14),
+        std::pair<int, int>(13, 15),
+        std::pair<int, int>(15, 22),
+        std::pair<int, int>(25, 16),
+        std::pair<int, int>(16, 10),
+        std::pair<int, int>(10, 2),
+        std::pair<int, int>(2, 6),
+        std::pair<int, int>(6, 13),
+        std::pair<int, int>(13, 19),
+    };
+
+    auto encodings = std::vector<CardinalityEncoding>{
+        CardinalityEncoding::Totalizer,
+        CardinalityEncoding::TruncatedTotalizer,
+        CardinalityEncoding::SequentialCounter,
+        CardinalityEncoding::CardinalityNetwork,
+        CardinalityEncoding::ModuloTotalizer
+    };
+    for (unsigned i = 0; i < encodings.size(); i++) {
+        Graph graph = Graph(32, edges);
+        graph.SetCardinalityEncoding(encodings[i]);
+        std::vector<int> result = graph.GetMinimalVertexCover_CNF_SAT();
+        validateVertexCoverResult_CNF_SAT(result, 8, edges);
+    }
+}
+
+TEST_CASE("GetMinimalVertexCover_CNF_SAT_WithKnownCover") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(21, 4),
+        std::pair<int, int>(4, 2),
+        std::pair<int, int>(2, 1),
+        std::pair<int, int>(1, 3),
+        std::pair<int, int>(3, 20),
+        std::pair<int, int>(23, 14),
+        std::pair<int, int>(14, 1),
+        std::pair<int, int>(1, 5),
+        std::pair<int, int>(5, 14),
+        std::pair<int, int>(13, 15),
+        std::pair<int, int>(15, 22),
+        std::pair<int, int>(25, 16),
+        std::pair<int, int>(16, 10),
+        std::pair<int, int>(10, 2),
+        std::pair<int, int>(2, 6),
+        std::pair<int, int>(6, 13),
+        std::pair<int, int>(13, 19),
+    };
+
+    Graph graph = Graph(32, edges);
+    std::vector<int> knownCover = std::vector<int>();
+    graph.getVertexCoverWithAPPROX_VC_2(knownCover);
+    std::vector<int> result = graph.GetMinimalVertexCover_CNF_SAT(knownCover);
+    validateVertexCoverResult_CNF_SAT(result, 8, edges);
+
+    // known cover is already minimal
+    std::vector<int> minimalCover = {1, 2, 3, 4, 13, 14, 15, 16};
+    result = graph.GetMinimalVertexCover_CNF_SAT(minimalCover);
+    validateVertexCoverResult_CNF_SAT(result, 8, edges);
+}
+
+TEST_CASE("IsMinimalVertexCoverCandidate") {
+    // a path of 6 vertices, whose minimal cover has 3 vertices
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 4),
+        std::pair<int, int>(4, 5),
+        std::pair<int, int>(5, 6)
+    };
+
+    Graph graph = Graph(6, edges);
+    std::vector<int> knownCover = {1, 3, 4, 5};
+    REQUIRE(graph.IsMinimalVertexCoverCandidate(std::vector<int>({2, 4, 5}), knownCover));
+    REQUIRE(graph.IsMinimalVertexCoverCandidate(std::vector<int>({1, 3, 4, 5}), knownCover));
+    // larger than the known cover
+    REQUIRE_FALSE(graph.IsMinimalVertexCoverCandidate(std::vector<int>({1, 2, 4, 5, 6}), knownCover));
+    // not in ascending order, or with a duplicate
+    REQUIRE_FALSE(graph.IsMinimalVertexCoverCandidate(std::vector<int>({4, 2, 5}), knownCover));
+    REQUIRE_FALSE(graph.IsMinimalVertexCoverCandidate(std::vector<int>({2, 4, 4, 5}), knownCover));
+    // not a cover
+    REQUIRE_FALSE(graph.IsMinimalVertexCoverCandidate(std::vector<int>({2, 5}), knownCover));
+
+    // a star has a matching of one edge, so a cover of more than its two vertices is not minimal even without a known cover
+    Graph star = Graph(5, std::vector<std::pair<int, int>>({
+        std::pair<int, int>(1, 2), std::pair<int, int>(1, 3), std::pair<int, int>(1, 4), std::pair<int, int>(1, 5)}));
+    REQUIRE(star.IsMinimalVertexCoverCandidate(std::vector<int>({1}), std::vector<int>()));
+    REQUIRE_FALSE(star.IsMinimalVertexCoverCandidate(std::vector<int>({2, 3, 4, 5}), std::vector<int>()));
+}
+
 TEST_CASE("GetMinimalVertexCover_APPROX_VC_1_Sample") {
     std::vector<std::pair<int, int>> edges = {
         std::pair<int, int>(3, 2),
@@ -269,6 +370,23 @@ TEST_CASE("GetMinimalVertexCover_APPROX_VC_1_MaxDegreeFirst") {
     REQUIRE_EQ(result[0], 3);
 }
 
+TEST_CASE("GetMinimalVertexCover_APPROX_VC_1_IgnoreDuplicatedEdge") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 1),
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(1, 3),
+        std::pair<int, int>(4, 4)
+    };
+
+    Graph graph = Graph(5, edges);
+    std::vector<int> result = std::vector<int>();
+    graph.getVertexCoverWithAPPROX_VC_1(result);
+    REQUIRE_EQ(result.size(), 2);
+    REQUIRE_EQ(result[0], 1);
+    REQUIRE_EQ(result[1], 4);
+}
+
 TEST_CASE("GetMinimalVertexCover_APPROX_VC_1_Complex") {
     std::vector<std::pair<int, int>> edges = {
         std::pair<int, int>(21, 4),
@@ -306,6 +424,27 @@ TEST_CASE("GetMinimalVertexCover_APPROX_VC_1_Complex") {
         || (result[2] == 13 && result[3] == 14 && result[4] == 16 && result[5] == 20 && result[6] == 21 && result[7] == 22)));
 }
 
+TEST_CASE("GetMinimalVertexCover_APPROX_VC_1_WithinGreedyBound") {
+    // picking the vertex of highest degree first gives a cover at most H(max degree) times the minimal size
+    std::mt19937 generator(650);
+    for (int round = 0; round < 100; round++) {
+        Graph graph = getRandomTestGraph(generator, 2 + round % 15, std::uniform_int_distribution<int>(0, 30)(generator));
+        int maxDegree = 0;
+        for (int i = 1; i <= graph.GetVertexCount(); i++) {
+            maxDegree = std::max(maxDegree, (int)(graph.GetNeighborsEnd(i) - graph.GetNeighborsBegin(i)));
+        }
+        double harmonicNumber = 0;
+        for (int degree = 1; degree <= maxDegree; degree++) {
+            harmonicNumber += 1.0 / degree;
+        }
+
+        std::vector<int> result = std::vector<int>();
+        graph.getVertexCoverWithAPPROX_VC_1(result);
+        REQUIRE(graph.IsVertexCover(result));
+        REQUIRE_LE(result.size(), getMinimalVertexCoverByEnumeration(graph).size() * harmonicNumber + 1e-9);
+    }
+}
+
 TEST_CASE("GetMinimalVertexCover_APPROX_VC_2_Sample") {
     std::vector<std::pair<int, int>> edges = {
         std::pair<int, int>(3, 2),
@@ -381,3 +520,19 @@ TEST_CASE("GetMinimalVertexCover_APPROX_VC_2_Complex") {
     graph.getVertexCoverWithAPPROX_VC_2(result);
     validateVertexCoverResult_APPROX_VC_2(result, edges);
 }
+
+TEST_CASE("GetMinimalVertexCover_APPROX_VC_2_SelfLoopAddedOnce") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 1),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 2)
+    };
+
+    Graph graph = Graph(5, edges);
+    std::vector<int> result = std::vector<int>();
+    graph.getVertexCoverWithAPPROX_VC_2(result);
+    REQUIRE_EQ(result.size(), 3);
+    REQUIRE_EQ(result[0], 1);
+    REQUIRE_EQ(result[1], 2);
+    REQUIRE_EQ(result[2], 3);
+}
@@ -0,0 +1,131 @@
+#include <cstdio>
+#include <fstream>
+#include <cstring>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/GraphFile.h"
+
+std::string getGraphFilePath() {
+    return "/tmp/test_GraphFile_" + std::to_string(getpid()) + ".vcg";
+}
+
+TEST_CASE("GraphFile_RoundTrip") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 1),
+        std::pair<int, int>(4, 4),
+        std::pair<int, int>(5, 2)
+    };
+    Graph graph = Graph(6, edges);
+    std::string path = getGraphFilePath();
+
+    for (int withChecksum = 0; withChecksum < 2; withChecksum++) {
+        WriteGraphFile(graph, path, withChecksum);
+        auto mapped = OpenGraphFile(path, true);
+        REQUIRE_EQ(mapped->GetVertexCount(), 6);
+        for (int i = 1; i <= 6; i++) {
+            auto expected = std::vector<int>(graph.GetNeighborsBegin(i), graph.GetNeighborsEnd(i));
+            auto actual = std::vector<int>(mapped->GetNeighborsBegin(i), mapped->GetNeighborsEnd(i));
+            REQUIRE_EQ(actual, expected);
+        }
+        REQUIRE_EQ(mapped->GetMinimalVertexCover_CNF_SAT().size(), graph.GetMinimalVertexCover_CNF_SAT().size());
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("GraphFile_RejectCorruption") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3)
+    };
+    Graph graph = Graph(3, edges);
+    std::string path = getGraphFilePath();
+    WriteGraphFile(graph, path, true);
+
+    // flip a byte of the last neighbor
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put(1);
+    }
+    REQUIRE_THROWS_AS(OpenGraphFile(path, true), std::runtime_error);
+    // the CSR form is still validated without checksum
+    REQUIRE_THROWS_AS(OpenGraphFile(path, false), std::runtime_error);
+
+    // truncated file
+    WriteGraphFile(graph, path, true);
+    REQUIRE_EQ(truncate(path.c_str(), 40), 0);
+    REQUIRE_THROWS_AS(OpenGraphFile(path, true), std::runtime_error);
+
+    // not a graph file
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "V 3" << std::endl << "E {<1,2>,<2,3>}" << std::endl;
+    }
+    REQUIRE_THROWS_AS(OpenGraphFile(path, true), std::runtime_error);
+
+    std::remove(path.c_str());
+    REQUIRE_THROWS_AS(OpenGraphFile(path, true), std::runtime_error);
+}
+
+TEST_CASE("Graph_InvalidCSR") {
+    // 1-2, 2-3 in CSR form
+    int offsets[] = {0, 0, 1, 3, 4};
+    int neighbors[] = {2, 1, 3, 2};
+    Graph graph = Graph(3, offsets, neighbors, nullptr);
+    REQUIRE_EQ(graph.GetNeighborsEnd(2) - graph.GetNeighborsBegin(2), 2);
+
+    // missing 2-1
+    int asymmetric[] = {2, 3, 3, 2};
+    REQUIRE_THROWS_AS(Graph(3, offsets, asymmetric, nullptr), std::invalid_argument);
+
+    int outOfRange[] = {2, 1, 4, 2};
+    REQUIRE_THROWS_AS(Graph(3, offsets, outOfRange, nullptr), std::invalid_argument);
+
+    int descending[] = {0, 0, 3, 1, 4};
+    REQUIRE_THROWS_AS(Graph(3, descending, neighbors, nullptr), std::invalid_argument);
+}
+
+TEST_CASE("Graph_InvalidCSROffsetBeforeLastNeighbor") {
+    // a self loop at each of 4 vertices in CSR form, so the neighbors ascend to the end of the array
+    // the offset of vertex 2 is far past the last neighbor, and the last offset is still right
+    int offsets[] = {0, 0, 1000, 2, 3, 4};
+    int neighbors[] = {1, 2, 3, 4};
+
+    // neighbors end at a page that cannot be read, so reading past them faults instead of throwing
+    long pageSize = sysconf(_SC_PAGESIZE);
+    char *pages = (char*)mmap(nullptr, pageSize * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(pages != MAP_FAILED);
+    REQUIRE_EQ(mprotect(pages + pageSize, pageSize, PROT_NONE), 0);
+    int *mappedNeighbors = (int*)(pages + pageSize) - 4;
+    std::memcpy(mappedNeighbors, neighbors, sizeof(neighbors));
+    bool isRejected = false;
+    try {
+        Graph graph = Graph(4, offsets, mappedNeighbors, nullptr);
+    }
+    catch (std::invalid_argument &) {
+        isRejected = true;
+    }
+    munmap(pages, pageSize * 2);
+    REQUIRE(isRejected);
+
+    // the same arrays in a file without checksum
+    Graph graph = Graph(4, std::vector<std::pair<int, int>>({
+        std::pair<int, int>(1, 1), std::pair<int, int>(2, 2), std::pair<int, int>(3, 3), std::pair<int, int>(4, 4)}));
+    std::string path = getGraphFilePath();
+    WriteGraphFile(graph, path, false);
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        // offsets follow the 40 bytes of header
+        file.seekp(40 + 2 * sizeof(int32_t));
+        int32_t offset = 1000;
+        file.write((const char*)&offset, sizeof(offset));
+    }
+    REQUIRE_THROWS_AS(OpenGraphFile(path, false), std::runtime_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,109 @@
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/GraphFormatReader.h"
+
+// Graph of input in format, read with a tiny buffer so lines cross the buffer boundary
+std::shared_ptr<Graph> readGraphOfFormat(const std::string &input, GraphFormat format) {
+    std::stringstream inputStream(input);
+    GraphFormatReader reader(inputStream, 4);
+    return reader.Read(format);
+}
+
+// Edges of graph, each once with the smaller vertex first
+std::vector<std::pair<int, int>> getEdgeList(const Graph &graph) {
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= graph.GetVertexCount(); i++) {
+        for (const int *neighbor = graph.GetNeighborsBegin(i); neighbor != graph.GetNeighborsEnd(i); neighbor++) {
+            if (*neighbor >= i) {
+                edges.push_back(std::pair<int, int>(i, *neighbor));
+            }
+        }
+    }
+    return edges;
+}
+
+// Error message of reading input in format, empty if there is none
+std::string getFormatErrorMessage(const std::string &input, GraphFormat format) {
+    try {
+        readGraphOfFormat(input, format);
+    }
+    catch (std::invalid_argument &e) {
+        return e.what();
+    }
+    return "";
+}
+
+const std::vector<std::pair<int, int>> expectedEdges = {
+    std::pair<int, int>(1, 2),
+    std::pair<int, int>(1, 3),
+    std::pair<int, int>(2, 3),
+    std::pair<int, int>(3, 4)
+};
+
+TEST_CASE("GraphFormatReader_SameGraphOfAllFormats") {
+    std::string dimacs = "c triangle with a tail\np edge 5 4\ne 1 2\ne 1 3\ne 2 3\r\ne 4 3";
+    std::string metis = "% comment\n5 4\n2 3\n1 3\n1 2 4\n3\n\n";
+    std::string snap = "# FromNodeId\tToNodeId\n0\t1\n0\t2\n1\t2\n2\t3\n4\t4\n";
+    std::string matrixMarket = "%%MatrixMarket matrix coordinate real general\n% comment\n5 5 6\n2 1 0.5\n3 1 1\n3 2 1\n4 3 1\n1 3 1\n5 5 2\n";
+
+    auto graph = readGraphOfFormat(dimacs, GraphFormat::DIMACS);
+    REQUIRE_EQ(graph->GetVertexCount(), 5);
+    REQUIRE_EQ(getEdgeList(*graph), expectedEdges);
+
+    graph = readGraphOfFormat(metis, GraphFormat::METIS);
+    REQUIRE_EQ(graph->GetVertexCount(), 5);
+    REQUIRE_EQ(getEdgeList(*graph), expectedEdges);
+
+    graph = readGraphOfFormat(matrixMarket, GraphFormat::MatrixMarket);
+    REQUIRE_EQ(graph->GetVertexCount(), 5);
+    REQUIRE_EQ(getEdgeList(*graph), expectedEdges);
+
+    // SNAP keeps self loops
+    graph = readGraphOfFormat(snap, GraphFormat::SNAP);
+    REQUIRE_EQ(graph->GetVertexCount(), 5);
+    auto snapEdges = expectedEdges;
+    snapEdges.push_back(std::pair<int, int>(5, 5));
+    REQUIRE_EQ(getEdgeList(*graph), snapEdges);
+}
+
+TEST_CASE("GraphFormatReader_METISWeights") {
+    // vertex sizes, two vertex weights and edge weights
+    std::string metis = "3 2 111 2\n1 5 5 2 7\n1 5 5 1 7 3 9\n1 5 5 2 9\n";
+    auto graph = readGraphOfFormat(metis, GraphFormat::METIS);
+    REQUIRE_EQ(getEdgeList(*graph), std::vector<std::pair<int, int>>({std::pair<int, int>(1, 2), std::pair<int, int>(2, 3)}));
+}
+
+TEST_CASE("GraphFormatReader_Complement") {
+    auto graph = readGraphOfFormat("p col 4 2\ne 1 2\ne 3 4\n", GraphFormat::DIMACS);
+    auto complement = GraphFormatReader::GetComplement(*graph);
+    REQUIRE_EQ(getEdgeList(*complement), std::vector<std::pair<int, int>>({
+        std::pair<int, int>(1, 3),
+        std::pair<int, int>(1, 4),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(2, 4)
+    }));
+}
+
+TEST_CASE("GraphFormatReader_Errors") {
+    REQUIRE_EQ(getFormatErrorMessage("e 1 2\n", GraphFormat::DIMACS), "edge before problem line when parsing DIMACS at line 1");
+    REQUIRE_EQ(getFormatErrorMessage("p edge 3 1\ne 1 4\n", GraphFormat::DIMACS), "vertex index out of range when parsing DIMACS edge at line 2");
+    REQUIRE_EQ(getFormatErrorMessage("c only\n", GraphFormat::DIMACS), "missing problem line when parsing DIMACS at line 1");
+    REQUIRE_EQ(getFormatErrorMessage("", GraphFormat::DIMACS), "missing problem line when parsing DIMACS on empty input");
+    REQUIRE_EQ(getFormatErrorMessage("p edge 3 2\ne 1 2\n", GraphFormat::DIMACS), "edge count differs from the problem line when parsing DIMACS at line 2");
+    REQUIRE_EQ(getFormatErrorMessage("", GraphFormat::METIS), "missing header when parsing METIS on empty input");
+    REQUIRE_EQ(getFormatErrorMessage("3 1\n2\n1 3\n2\n", GraphFormat::METIS), "edge count differs from the header when parsing METIS at line 4");
+    REQUIRE_EQ(getFormatErrorMessage("3 1\n2\n1\n", GraphFormat::METIS), "missing vertex lines when parsing METIS at line 3");
+    REQUIRE_EQ(getFormatErrorMessage("2 1\n2\n1 x\n", GraphFormat::METIS), "not able to convert vertex index to int when parsing METIS at line 3");
+    REQUIRE_EQ(getFormatErrorMessage("0 1\n-1 2\n", GraphFormat::SNAP), "not able to convert vertex id to int when parsing SNAP edge at line 2");
+    REQUIRE_EQ(getFormatErrorMessage("%%MatrixMarket matrix array real general\n2 2\n", GraphFormat::MatrixMarket),
+        "only coordinate matrices are supported when parsing Matrix Market header at line 1");
+    REQUIRE_EQ(getFormatErrorMessage("%%MatrixMarket matrix coordinate pattern symmetric\n2 3 1\n1 2\n", GraphFormat::MatrixMarket),
+        "matrix is not square when parsing Matrix Market size line at line 2");
+    REQUIRE_EQ(getFormatErrorMessage("%%MatrixMarket matrix coordinate pattern symmetric\n2 2 2\n1 2\n", GraphFormat::MatrixMarket),
+        "fewer entries than the size line when parsing Matrix Market at line 3");
+    REQUIRE_THROWS_AS(ParseGraphFormat("csv"), std::invalid_argument);
+}
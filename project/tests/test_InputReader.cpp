@@ -0,0 +1,75 @@
+#include <sstream>
+#include <string>
+
+#include "doctest.h"
+#include "../src/InputReader.h"
+
+// Outputs of all lines of input, read by reader with a tiny buffer, and errors in the format of main
+std::string readAllWithInputReader(const std::string &input, int bufferSize) {
+    std::stringstream inputStream(input);
+    InputReader reader(inputStream, bufferSize);
+    VertexCoverSolver solver = VertexCoverSolver();
+    std::stringstream output;
+    while (true) {
+        try {
+            std::function<std::string()> solve;
+            if (!reader.AcceptNextLine(solver, solve)) {
+                break;
+            }
+            if (solve) {
+                output << solve();
+            }
+        }
+        catch (std::invalid_argument &e) {
+            output << "Error: " << e.what() << std::endl;
+        }
+    }
+    return output.str();
+}
+
+// CNF-SAT-VC and error lines only, since APPROX-VC-2 picks random edges
+std::string getDeterministicLines(const std::string &output) {
+    std::stringstream outputStream(output);
+    std::string line, result;
+    while (std::getline(outputStream, line)) {
+        if (line.compare(0, 13, "APPROX-VC-2: ") != 0) {
+            result += line + "\n";
+        }
+    }
+    return result;
+}
+
+TEST_CASE("InputReader_SameAsAcceptLine") {
+    std::string input =
+        "V 5\n"
+        "E {<1,2>,<2,3>,<3,4>,<4,5>,<5,1>,<1,3>}\n"
+        "\n"
+        "   \n"
+        "V 6\n"
+        "  E {<1,2>,<2,3>,<3,4>,<4,5>,<5,6>}  \n"
+        "V 6\n"
+        "E {<1,2>,<2,3>,<3,4>,<4,5>,<5,7>}\n"
+        "V 1\n"
+        "E {<1,2>,<2,3>,<3,4>,<4,5>,<5,6>,<6,1>}\n"
+        "V 3\n"
+        "E {<1,2>,<2,3>,<3,1>,<1,2>,<2,3>,<3,1>} }\n"
+        "V 3\n"
+        "E {<1,2>,<2,3>,<3,1>}";
+
+    std::stringstream inputStream(input);
+    VertexCoverSolver solver = VertexCoverSolver();
+    std::string expected;
+    std::string line;
+    while (std::getline(inputStream, line)) {
+        try {
+            expected += solver.AcceptLine(line);
+        }
+        catch (std::invalid_argument &e) {
+            expected += std::string("Error: ") + e.what() + "\n";
+        }
+    }
+
+    for (int bufferSize = 1; bufferSize <= 64; bufferSize *= 2) {
+        REQUIRE_EQ(getDeterministicLines(readAllWithInputReader(input, bufferSize)), getDeterministicLines(expected));
+    }
+}
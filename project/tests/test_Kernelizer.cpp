@@ -0,0 +1,106 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "doctest.h"
+#include "TestGraphs.h"
+#include "../src/Kernelizer.h"
+
+void validateCover(const std::vector<int> &result, const std::vector<std::pair<int, int>> &edges) {
+    auto coverSet = std::set<int>(result.begin(), result.end());
+    REQUIRE_EQ(coverSet.size(), result.size());
+    for (unsigned i = 0; i < edges.size(); i++) {
+        REQUIRE((coverSet.count(edges[i].first) == 1 || coverSet.count(edges[i].second) == 1));
+    }
+}
+
+TEST_CASE("Kernelizer_PathReducedCompletely") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 4),
+        std::pair<int, int>(4, 5),
+        std::pair<int, int>(5, 6)
+    };
+
+    Graph graph = Graph(6, edges);
+    Kernelizer kernelizer(graph, -1);
+    REQUIRE_EQ(kernelizer.GetKernel().GetVertexCount(), 0);
+
+    auto result = kernelizer.LiftCover(std::vector<int>());
+    REQUIRE_EQ(result.size(), 3);
+    validateCover(result, edges);
+}
+
+TEST_CASE("Kernelizer_FoldCycle") {
+    // every vertex of a 5-cycle has degree 2 with non-adjacent neighbors
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 4),
+        std::pair<int, int>(4, 5),
+        std::pair<int, int>(5, 1)
+    };
+
+    Graph graph = Graph(5, edges);
+    Kernelizer kernelizer(graph, -1);
+    auto kernelCover = getMinimalVertexCoverByEnumeration(kernelizer.GetKernel());
+    auto result = kernelizer.LiftCover(kernelCover);
+    REQUIRE_EQ(result.size(), 3);
+    validateCover(result, edges);
+}
+
+TEST_CASE("Kernelizer_SelfLoopTaken") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 1),
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(3, 3)
+    };
+
+    Graph graph = Graph(3, edges);
+    Kernelizer kernelizer(graph, -1);
+    auto result = kernelizer.LiftCover(std::vector<int>());
+    REQUIRE_EQ(result.size(), 2);
+    REQUIRE_EQ(result[0], 1);
+    REQUIRE_EQ(result[1], 3);
+}
+
+TEST_CASE("Kernelizer_CompleteGraphKeptWithoutBound") {
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= 5; i++) {
+        for (int j = i + 1; j <= 5; j++) {
+            edges.push_back(std::pair<int, int>(i, j));
+        }
+    }
+
+    Graph graph = Graph(5, edges);
+    Kernelizer kernelizer(graph, -1);
+    REQUIRE_EQ(kernelizer.GetKernel().GetVertexCount(), 5);
+}
+
+TEST_CASE("Kernelizer_RandomGraphsKeepMinimalSize") {
+    std::mt19937 generator(650);
+    for (int round = 0; round < 200; round++) {
+        int nVertex = 2 + round % 11;
+        int nEdges = std::uniform_int_distribution<int>(1, nVertex * 2)(generator);
+        auto edges = std::vector<std::pair<int, int>>();
+        for (int i = 0; i < nEdges; i++) {
+            edges.push_back(std::pair<int, int>(
+                std::uniform_int_distribution<int>(1, nVertex)(generator),
+                std::uniform_int_distribution<int>(1, nVertex)(generator)));
+        }
+
+        Graph graph = Graph(nVertex, edges);
+        auto expected = getMinimalVertexCoverByEnumeration(graph);
+
+        Kernelizer kernelizer(graph, expected.size());
+        auto kernelCover = getMinimalVertexCoverByEnumeration(kernelizer.GetKernel());
+        auto result = kernelizer.LiftCover(kernelCover);
+        REQUIRE_EQ(result.size(), expected.size());
+        validateCover(result, edges);
+
+        auto resultWithSolver = graph.GetMinimalVertexCover_CNF_SAT();
+        REQUIRE_EQ(resultWithSolver.size(), expected.size());
+        validateCover(resultWithSolver, edges);
+    }
+}
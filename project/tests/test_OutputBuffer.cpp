@@ -0,0 +1,59 @@
+#include <climits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/BufferedWriter.h"
+#include "../src/OutputBuffer.h"
+
+TEST_CASE("OutputBuffer_AppendInt") {
+    std::vector<int> values = {0, 7, 10, 99, 100, 12345, 1000000000, INT_MAX, -1, -100, INT_MIN};
+    OutputBuffer output;
+    for (unsigned i = 0; i < values.size(); i++) {
+        output.Clear();
+        output.AppendInt(values[i]);
+        REQUIRE_EQ(output.GetText(), std::to_string(values[i]));
+    }
+}
+
+TEST_CASE("OutputBuffer_AppendList") {
+    OutputBuffer output;
+    output.Append("CNF-SAT-VC: ");
+    output.AppendList(std::vector<int>());
+    output.Append('\n');
+    output.Append(std::string("APPROX-VC-1: "));
+    output.AppendList(std::vector<int>({3, 42, 512, 100000}));
+    REQUIRE_EQ(output.GetText(), "CNF-SAT-VC: \nAPPROX-VC-1: 3,42,512,100000");
+}
+
+TEST_CASE("OutputBuffer_TakeText") {
+    std::vector<int> values = {1, 9, 10, 1234};
+    OutputBuffer output;
+    output.Reserve(OutputBuffer::GetListLength(values));
+    output.AppendList(values);
+    REQUIRE_LE(output.GetText().size(), OutputBuffer::GetListLength(values));
+    REQUIRE_EQ(output.TakeText(), "1,9,10,1234");
+    REQUIRE_EQ(output.GetText(), "");
+}
+
+TEST_CASE("BufferedWriter_WriteInOrder") {
+    std::stringstream stream;
+    std::string expected;
+    {
+        BufferedWriter writer(stream, 8);
+        writer.Write("abc");
+        REQUIRE_EQ(stream.str(), "");
+        writer.Write("defghij");
+        // larger than the buffer
+        writer.Write(std::string(20, 'x'));
+        writer.Write("end");
+        expected = "abcdefghij" + std::string(20, 'x');
+        REQUIRE_EQ(stream.str(), expected);
+        writer.Flush();
+        REQUIRE_EQ(stream.str(), expected + "end");
+        writer.Write("!");
+    }
+    // flushed when destroyed
+    REQUIRE_EQ(stream.str(), expected + "end!");
+}
@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "doctest.h"
@@ -220,3 +225,90 @@ TEST_CASE("GetEdges_WrongFormat") {
     Parser parser = Parser();
     REQUIRE_THROWS(parser.GetEdges("E <1,3>,<2,3>", 15));
 }
+
+// Message of the invalid_argument thrown by f, or empty if nothing is thrown
+std::string getErrorMessage(const std::function<void()> &f) {
+    try {
+        f();
+    }
+    catch (std::invalid_argument &e) {
+        return e.what();
+    }
+    return "";
+}
+
+TEST_CASE("GetEdges_ErrorOfFirstInvalidPart") {
+    Parser parser = Parser();
+    REQUIRE_EQ(getErrorMessage([&]() { parser.GetEdges("E {<1>,2>}", 15); }), "not able to convert vertex index to int when parsing edges");
+    REQUIRE_EQ(getErrorMessage([&]() { parser.GetEdges("E {<1,2>,<16,1>}", 15); }), "vertex index exceeds the maximum allowed value");
+    REQUIRE_EQ(getErrorMessage([&]() { parser.GetEdges("E {<1,2>,<3,1}", 15); }), "wrong format when parsing edges");
+    REQUIRE_EQ(getErrorMessage([&]() { parser.GetEdges("E {<1,2><2,3>}", 15); }), "expecting ',' when parsing edges");
+}
+
+TEST_CASE("GetEdges_IntOverflow") {
+    Parser parser = Parser();
+    REQUIRE_EQ(getErrorMessage([&]() { parser.GetEdges("E {<1,2147483647>}", 15); }), "vertex index exceeds the maximum allowed value");
+    REQUIRE_EQ(getErrorMessage([&]() { parser.GetEdges("E {<1,2147483648>}", 15); }), "not able to convert vertex index to int when parsing edges");
+}
+
+TEST_CASE("GetEdges_Range") {
+    Parser parser = Parser();
+    std::string line = "  E {<1,2>,<2,3>}  ";
+    std::vector<std::pair<int, int>> result = parser.GetEdges(line.data() + 2, line.data() + line.size() - 2, 3);
+    REQUIRE_EQ(result.size(), 2);
+    REQUIRE_EQ(result[1].first, 2);
+    REQUIRE_EQ(result[1].second, 3);
+}
+
+TEST_CASE("EdgeLineStream_SameAsGetEdges") {
+    std::mt19937 generator(650);
+    const char alphabet[] = "<>,{} E0123456789x";
+    for (int round = 0; round < 20000; round++) {
+        // random edges of a valid line, with a few characters replaced, removed or inserted
+        int nVertex = std::uniform_int_distribution<int>(1, 30)(generator);
+        std::string line = "E {";
+        int nEdges = std::uniform_int_distribution<int>(0, 5)(generator);
+        for (int i = 0; i < nEdges; i++) {
+            line += (i > 0 ? ",<" : "<") + std::to_string(generator() % 32) + "," + std::to_string(generator() % 32) + ">";
+        }
+        line += "}";
+        int nChanges = std::uniform_int_distribution<int>(0, 2)(generator);
+        for (int i = 0; i < nChanges; i++) {
+            int position = generator() % line.size();
+            char c = alphabet[generator() % (sizeof(alphabet) - 1)];
+            int change = generator() % 3;
+            if (change == 0) {
+                line[position] = c;
+            } else if (change == 1) {
+                line.erase(position, 1);
+            } else {
+                line.insert(position, 1, c);
+            }
+        }
+        std::string paddedLine = std::string(generator() % 3, ' ') + line + std::string(generator() % 3, ' ');
+
+        auto expected = std::vector<std::pair<int, int>>();
+        std::string expectedError;
+        size_t trimBegin = paddedLine.find_first_not_of(' ');
+        if (trimBegin == std::string::npos) {
+            continue;
+        }
+        std::string trimmedLine = paddedLine.substr(trimBegin, paddedLine.find_last_not_of(' ') - trimBegin + 1);
+        Parser parser = Parser();
+        expectedError = getErrorMessage([&]() { expected = parser.GetEdges(trimmedLine, nVertex); });
+
+        // the line split at random positions
+        EdgeLineStream stream(nVertex);
+        unsigned partBegin = 0;
+        while (partBegin < paddedLine.size()) {
+            unsigned partEnd = std::min<unsigned>(paddedLine.size(), partBegin + generator() % 5);
+            stream.Append(paddedLine.data() + partBegin, paddedLine.data() + partEnd);
+            partBegin = partEnd;
+        }
+        REQUIRE_FALSE(stream.IsBlank());
+        auto result = std::vector<std::pair<int, int>>();
+        std::string error = getErrorMessage([&]() { result = stream.Finish(); });
+        REQUIRE_EQ(error, expectedError);
+        REQUIRE(result == expected);
+    }
+}
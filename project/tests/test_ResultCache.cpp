@@ -0,0 +1,75 @@
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/ResultCache.h"
+#include "../src/VertexCoverSolver.h"
+
+TEST_CASE("GraphFingerprint_SameForSameEdgeSet") {
+    std::vector<std::pair<int, int>> edges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 3),
+        std::pair<int, int>(3, 4)
+    };
+    // reversed, reordered and repeated
+    std::vector<std::pair<int, int>> sameEdges = {
+        std::pair<int, int>(4, 3),
+        std::pair<int, int>(2, 1),
+        std::pair<int, int>(3, 2),
+        std::pair<int, int>(1, 2)
+    };
+    std::vector<std::pair<int, int>> otherEdges = {
+        std::pair<int, int>(1, 2),
+        std::pair<int, int>(2, 4),
+        std::pair<int, int>(3, 4)
+    };
+
+    auto fingerprint = GetGraphFingerprint(Graph(4, edges));
+    REQUIRE(fingerprint == GetGraphFingerprint(Graph(4, sameEdges)));
+    REQUIRE_FALSE(fingerprint == GetGraphFingerprint(Graph(4, otherEdges)));
+    // an isolated vertex more
+    REQUIRE_FALSE(fingerprint == GetGraphFingerprint(Graph(5, edges)));
+}
+
+TEST_CASE("ResultCache_EvictLeastRecentlyUsed") {
+    auto getFingerprint = [](int nVertex) {
+        return GetGraphFingerprint(Graph(nVertex, std::vector<std::pair<int, int>>(1, std::pair<int, int>(1, 2))));
+    };
+    ResultCache cache(2);
+    CachedCovers covers;
+    for (int i = 2; i <= 4; i++) {
+        covers.exact = std::vector<int>(1, i);
+        cache.Insert(getFingerprint(i), covers);
+        if (i == 3) {
+            // graph of 2 vertices becomes the most recently used
+            REQUIRE(cache.Find(getFingerprint(2), covers));
+        }
+    }
+
+    REQUIRE_EQ(cache.GetSize(), 2);
+    REQUIRE_FALSE(cache.Find(getFingerprint(3), covers));
+    REQUIRE(cache.Find(getFingerprint(2), covers));
+    REQUIRE_EQ(covers.exact, std::vector<int>(1, 2));
+    REQUIRE(cache.Find(getFingerprint(4), covers));
+    REQUIRE_EQ(covers.exact, std::vector<int>(1, 4));
+}
+
+TEST_CASE("VertexCoverSolver_RepeatedGraphFromCache") {
+    VertexCoverSolver solver = VertexCoverSolver();
+    solver.AcceptLine("V 30");
+    std::string edges = "E {";
+    for (int i = 1; i < 30; i++) {
+        edges += "<" + std::to_string(i) + "," + std::to_string(i + 1) + ">,<" + std::to_string(i) + "," + std::to_string(30 - i / 2) + ">,";
+    }
+    edges.back() = '}';
+    std::string output = solver.AcceptLine(edges);
+
+    // APPROX-VC-2 picks random edges, so only a cached output is the same as a whole
+    solver.AcceptLine("V 30");
+    REQUIRE_EQ(solver.AcceptLine(edges), output);
+
+    solver.SetResultCacheCapacity(0);
+    solver.AcceptLine("V 30");
+    std::string solvedAgain = solver.AcceptLine(edges);
+    REQUIRE_EQ(solvedAgain.substr(0, solvedAgain.find("APPROX-VC-2")), output.substr(0, output.find("APPROX-VC-2")));
+}
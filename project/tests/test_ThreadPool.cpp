@@ -0,0 +1,47 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/ThreadPool.h"
+
+TEST_CASE("ThreadPool_ParallelForRunsEveryIndex") {
+    ThreadPool pool(3);
+    auto counts = std::vector<std::atomic<int>>(100);
+    for (unsigned i = 0; i < counts.size(); i++) {
+        counts[i] = 0;
+    }
+    pool.ParallelFor(100, [&](int index) {
+        counts[index]++;
+    });
+    for (unsigned i = 0; i < counts.size(); i++) {
+        REQUIRE_EQ(counts[i].load(), 1);
+    }
+}
+
+TEST_CASE("ThreadPool_ParallelForRethrows") {
+    ThreadPool pool(2);
+    std::atomic<int> nFinished(0);
+    REQUIRE_THROWS_AS(pool.ParallelFor(10, [&](int index) {
+        if (index == 3) {
+            throw std::runtime_error("failure");
+        }
+        nFinished++;
+    }), std::runtime_error);
+    REQUIRE_EQ(nFinished.load(), 9);
+}
+
+TEST_CASE("ThreadPool_SubmitFuture") {
+    ThreadPool pool(2);
+    int value = 0;
+    auto future = pool.Submit([&]() {
+        value = 650;
+    });
+    future.get();
+    REQUIRE_EQ(value, 650);
+
+    auto failed = pool.Submit([]() {
+        throw std::runtime_error("failure");
+    });
+    REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+}
@@ -0,0 +1,52 @@
+#include <stdexcept>
+#include <vector>
+
+#include "doctest.h"
+#include "../src/TreeDecompositionSolver.h"
+
+// Grid of nRow rows and nColumn columns, whose treewidth is the smaller of them
+Graph getGridTestGraph(int nRow, int nColumn) {
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int row = 0; row < nRow; row++) {
+        for (int column = 0; column < nColumn; column++) {
+            int vertex = row * nColumn + column + 1;
+            if (column + 1 < nColumn) {
+                edges.push_back(std::pair<int, int>(vertex, vertex + 1));
+            }
+            if (row + 1 < nRow) {
+                edges.push_back(std::pair<int, int>(vertex, vertex + nColumn));
+            }
+        }
+    }
+    return Graph(nRow * nColumn, edges);
+}
+
+TEST_CASE("TreeDecompositionSolver_Grid") {
+    // a bipartite grid has a cover of half its vertices
+    Graph graph = getGridTestGraph(6, 200);
+    TreeDecompositionSolver solver(graph, 8);
+    REQUIRE(solver.IsDecomposed());
+    REQUIRE_LE(solver.GetWidth(), 8);
+    auto result = solver.Solve();
+    REQUIRE(graph.IsVertexCover(result));
+    REQUIRE_EQ(result.size(), 600);
+}
+
+TEST_CASE("TreeDecompositionSolver_TooWide") {
+    // a clique of 6 vertices has treewidth 5
+    auto edges = std::vector<std::pair<int, int>>();
+    for (int i = 1; i <= 6; i++) {
+        for (int j = i + 1; j <= 6; j++) {
+            edges.push_back(std::pair<int, int>(i, j));
+        }
+    }
+    Graph graph = Graph(6, edges);
+    TreeDecompositionSolver narrow(graph, 4);
+    REQUIRE_FALSE(narrow.IsDecomposed());
+    REQUIRE_EQ(narrow.GetWidth(), -1);
+    REQUIRE_THROWS_AS(narrow.Solve(), std::invalid_argument);
+
+    TreeDecompositionSolver wide(graph, 5);
+    REQUIRE_EQ(wide.GetWidth(), 5);
+    REQUIRE_EQ(wide.Solve().size(), 5);
+}